@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+namespace Benchmark
+{
+/**
+ * @brief Не дать компилятору удалить вычисление значения
+ */
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Измерить среднее время одной операции
+ *
+ * @param operations Количество операций, выполняемых за один вызов func
+ * @param func Измеряемая функция
+ * @return Время одной операции в наносекундах (минимум из нескольких повторов)
+ */
+template <typename Func>
+double nanosecondsPerOperation(std::size_t operations, Func&& func)
+{
+    using Clock = std::chrono::steady_clock;
+
+    func(); // прогрев кэшей
+
+    double best = 0.0;
+    for (int repeat = 0; repeat < 5; ++repeat)
+    {
+        auto start = Clock::now();
+        func();
+        auto stop = Clock::now();
+
+        double elapsed = std::chrono::duration<double, std::nano>(stop - start).count()
+                       / static_cast<double>(operations);
+        best = (repeat == 0 || elapsed < best) ? elapsed : best;
+    }
+    return best;
+}
+
+/**
+ * @brief Вывести строку результата сравнения двух реализаций
+ */
+inline void printRow(const std::string& name, double baseline, double optimized)
+{
+    std::cout << std::left << std::setw(32) << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << baseline
+              << std::setw(12) << optimized
+              << std::setw(10) << baseline / optimized << "x"
+              << std::endl;
+}
+
+/**
+ * @brief Вывести заголовок таблицы результатов
+ */
+inline void printHeader(const std::string& title, const std::string& baseline, const std::string& optimized)
+{
+    std::cout << title << std::endl
+              << std::left << std::setw(32) << "case"
+              << std::right << std::setw(12) << baseline
+              << std::setw(12) << optimized
+              << std::setw(11) << "speedup" << std::endl;
+}
+}
@@ -0,0 +1,71 @@
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/Chain.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/RateLimiter.hpp"
+#include "../include/SaturationBlock.hpp"
+
+using namespace SimulinkBlock;
+
+
+/**
+ * @brief Последовательные вызовы step()/getOutput() цепочки Integrator -> Saturation -> RateLimiter
+ */
+template <typename Mutex>
+double sequential(const std::vector<double>& inputs, double dt)
+{
+    IntegratorBlock<double, Mutex> integrator;
+    SaturationBlock<double, Mutex> saturation{-1, 1};
+    RateLimiter<double, Mutex> rateLimiter{0.5, -0.5};
+
+    return Benchmark::nanosecondsPerOperation(inputs.size(), [&]
+    {
+        for (double input : inputs)
+        {
+            integrator.step(input, dt);
+            saturation.step(integrator.getOutput());
+            rateLimiter.step(saturation.getOutput(), dt);
+            Benchmark::doNotOptimize(rateLimiter.getOutput());
+        }
+    });
+}
+
+/**
+ * @brief Та же цепочка, объединённая chain()
+ */
+template <typename Mutex>
+double fused(const std::vector<double>& inputs, double dt)
+{
+    IntegratorBlock<double, Mutex> integrator;
+    SaturationBlock<double, Mutex> saturation{-1, 1};
+    RateLimiter<double, Mutex> rateLimiter{0.5, -0.5};
+    auto blocks = chain(integrator, saturation, rateLimiter);
+
+    return Benchmark::nanosecondsPerOperation(inputs.size(), [&]
+    {
+        for (double input : inputs)
+        {
+            Benchmark::doNotOptimize(blocks.step(input, dt));
+        }
+    });
+}
+
+int main()
+{
+    constexpr std::size_t steps = 1000000;
+    constexpr double dt = 0.001;
+
+    std::vector<double> inputs(steps);
+    for (std::size_t i = 0; i < steps; i++)
+    {
+        inputs[i] = 3 * std::sin(0.001 * static_cast<double>(i));
+    }
+
+    Benchmark::printHeader("Integrator -> Saturation -> RateLimiter, ns per step", "sequential", "chain");
+    Benchmark::printRow("std::mutex", sequential<std::mutex>(inputs, dt), fused<std::mutex>(inputs, dt));
+    Benchmark::printRow("NullMutex", sequential<NullMutex>(inputs, dt), fused<NullMutex>(inputs, dt));
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/BandLimitedWhiteNoise.hpp"
+#include "../include/Checkpoint.hpp"
+#include "../include/FlightControllers/LateralControl.hpp"
+#include "../include/FlightControllers/LongitudalControl.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/Philox.hpp"
+
+using namespace SimulinkBlock;
+
+namespace
+{
+constexpr double dt = 0.01;
+
+/**
+ * @brief Регуляторы, турбулентность и простая модель движения самолёта
+ */
+struct Simulation
+{
+    LongitudalControl<double> longitudal;
+    LateralControl<double> lateral;
+    BandLimitedWhiteNoise<double, std::mutex, Philox4x32> turbulence{0.01, 0.1, Philox4x32(1)};
+    IntegratorBlock<double> altitude{0.0, 20000.0};
+    IntegratorBlock<double> velocity{0.0, 300.0};
+    IntegratorBlock<double> pitch{-1.0, 1.0};
+    IntegratorBlock<double> roll{-1.0, 1.0};
+    IntegratorBlock<double> yaw{-10.0, 10.0};
+    double time = 0.0;
+
+    Simulation()
+    {
+        longitudal.setVelocityPidCoeffs(0.5, 0.1, 0.0);
+        longitudal.setAltitudePidCoeffs(0.02, 0.002, 0.01);
+        longitudal.setPitchAnglePidCoeffs(1.5, 0.2, 0.1);
+        longitudal.setAngularVelocityPidCoeffs(0.8, 0.05, 0.0);
+        longitudal.setSaturationLimits(-0.3, 0.3);
+        lateral.setRudderControllCoeffs(0.3, 0.1);
+        lateral.setAileronControllCoeffs(0.4, 1.2, 0.05, 1.5, 0.2);
+        lateral.setRollSaturationLimits(-0.5, 0.5);
+        lateral.setRudderSaturationLimits(-0.4, 0.4);
+        lateral.setAileronsSaturationLimits(-0.4, 0.4);
+        altitude.setState(1000.0);
+        velocity.setState(60.0);
+    }
+
+    void step()
+    {
+        turbulence.step(time);
+        const double gust = turbulence.getOutput();
+        longitudal.step(1100.0, 65.0, altitude.getOutput(), velocity.getOutput(), pitch.getOutput(), 0.0, dt);
+        lateral.step(0.5, yaw.getOutput(), 0.0, roll.getOutput(), 0.0, dt);
+
+        pitch.step(longitudal.getOutput().first + gust - 0.5 * pitch.getOutput(), dt);
+        velocity.step(5.0 * longitudal.getOutput().second - 9.81 * pitch.getOutput(), dt);
+        altitude.step(velocity.getOutput() * pitch.getOutput(), dt);
+        roll.step(lateral.getOutput().first - 0.5 * roll.getOutput(), dt);
+        yaw.step(0.2 * roll.getOutput(), dt);
+        time += dt;
+    }
+
+    void save(std::vector<std::uint8_t>& buffer)
+    {
+        saveCheckpoint(buffer, longitudal, lateral, turbulence, altitude, velocity, pitch, roll, yaw);
+    }
+
+    void restore(const std::vector<std::uint8_t>& buffer)
+    {
+        restoreCheckpoint(buffer, longitudal, lateral, turbulence, altitude, velocity, pitch, roll, yaw);
+    }
+};
+}
+
+int main()
+{
+    constexpr std::size_t warmUpSteps = 60000; // 10 минут полёта
+
+    Simulation simulation;
+    for (std::size_t k = 0; k < warmUpSteps; k++)
+    {
+        simulation.step();
+    }
+    std::vector<std::uint8_t> checkpoint;
+    simulation.save(checkpoint);
+
+    const double rerun = Benchmark::nanosecondsPerOperation(1, [&]
+    {
+        Simulation fresh;
+        for (std::size_t k = 0; k < warmUpSteps; k++)
+        {
+            fresh.step();
+        }
+        Benchmark::doNotOptimize(fresh.altitude.getOutput());
+    });
+
+    Simulation target;
+    const double restore = Benchmark::nanosecondsPerOperation(1000, [&]
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            target.restore(checkpoint);
+        }
+        Benchmark::doNotOptimize(target.altitude.getOutput());
+    });
+
+    std::vector<std::uint8_t> buffer;
+    const double save = Benchmark::nanosecondsPerOperation(1000, [&]
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            simulation.save(buffer);
+        }
+        Benchmark::doNotOptimize(buffer.back());
+    });
+
+    Benchmark::printHeader("Re-entering t = 600 s, us", "re-run", "restore");
+    Benchmark::printRow("flight simulation", rerun / 1000.0, restore / 1000.0);
+    std::cout << std::endl << "checkpoint size: " << checkpoint.size() << " bytes, save: "
+              << std::fixed << std::setprecision(2) << save / 1000.0 << " us" << std::endl;
+    return 0;
+}
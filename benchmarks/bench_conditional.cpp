@@ -0,0 +1,105 @@
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/ConditionalSubsystem.hpp"
+#include "../include/FlightControllers/LongitudalControl.hpp"
+
+using namespace SimulinkBlock;
+
+namespace
+{
+constexpr std::size_t modes = 4;     // взлёт, набор высоты, крейсерский полёт, заход на посадку
+constexpr std::size_t steps = 100000;
+constexpr double dt = 0.01;
+
+/**
+ * @brief Регулятор одного режима полёта: руль высоты по заданной высоте
+ */
+struct ModeController
+{
+    LongitudalControl<double, NullMutex> control;
+    double desiredAltitude;
+
+    explicit ModeController(double altitude)
+        : desiredAltitude{altitude}
+    {
+        control.setVelocityPidCoeffs(0.5, 0.1, 0.0);
+        control.setAltitudePidCoeffs(0.02, 0.002, 0.01);
+        control.setPitchAnglePidCoeffs(1.5, 0.2, 0.1);
+        control.setAngularVelocityPidCoeffs(0.8, 0.05, 0.0);
+        control.setSaturationLimits(-0.3, 0.3);
+    }
+
+    double step(double altitude)
+    {
+        control.step(desiredAltitude, 65.0, altitude, 60.0, 0.05, 0.0, dt);
+        return control.getOutput().first;
+    }
+};
+
+/**
+ * @brief Режим полёта на шаге k, режим меняется каждые 10 секунд
+ */
+std::size_t modeAt(std::size_t k)
+{
+    return (k / 1000) % modes;
+}
+}
+
+int main()
+{
+    // Все регуляторы выполняются на каждом шаге, выход выбирается переключателем
+    std::array<ModeController, modes> always{ModeController(300), ModeController(1500),
+                                             ModeController(3000), ModeController(200)};
+    const double baseline = Benchmark::nanosecondsPerOperation(steps, [&]
+    {
+        double altitude = 1000.0;
+        for (std::size_t k = 0; k < steps; k++)
+        {
+            double elevator = 0.0;
+            for (std::size_t mode = 0; mode < modes; mode++)
+            {
+                const double output = always[mode].step(altitude);
+                elevator = mode == modeAt(k) ? output : elevator;
+            }
+            altitude += elevator * dt;
+        }
+        Benchmark::doNotOptimize(altitude);
+    });
+
+    // Каждый регулятор - включаемая подсистема, выполняется только активный
+    std::array<ModeController, modes> controllers{ModeController(300), ModeController(1500),
+                                                  ModeController(3000), ModeController(200)};
+    std::array<std::unique_ptr<ConditionalSubsystem<double, bool, NullMutex>>, modes> subsystems;
+    for (std::size_t mode = 0; mode < modes; mode++)
+    {
+        subsystems[mode] = std::make_unique<ConditionalSubsystem<double, bool, NullMutex>>(
+            Activation::Enabled, [&controller = controllers[mode]](const double& altitude, const double&)
+            {
+                return controller.step(altitude);
+            });
+        subsystems[mode]->setInactiveOutput(InactiveOutput::Reset);
+    }
+    const double conditional = Benchmark::nanosecondsPerOperation(steps, [&]
+    {
+        double altitude = 1000.0;
+        for (std::size_t k = 0; k < steps; k++)
+        {
+            double elevator = 0.0;
+            for (std::size_t mode = 0; mode < modes; mode++)
+            {
+                subsystems[mode]->step(altitude, mode == modeAt(k), dt);
+                elevator += subsystems[mode]->getOutput();
+            }
+            altitude += elevator * dt;
+        }
+        Benchmark::doNotOptimize(altitude);
+    });
+
+    Benchmark::printHeader("Mode-specific controllers, ns per step", "always", "enabled");
+    Benchmark::printRow("4 modes, 1 active", baseline, conditional);
+    return 0;
+}
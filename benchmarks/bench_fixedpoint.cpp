@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/FixedPoint.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/LookupTable1D.hpp"
+#include "../include/PID.hpp"
+#include "../include/RateLimiter.hpp"
+#include "../include/SaturationBlock.hpp"
+#include "../include/ThreadingPolicy.hpp"
+
+using namespace SimulinkBlock;
+
+namespace
+{
+/**
+ * @brief Контур управления: таблица коэффициента -> ПИД -> насыщение -> ограничение скорости -> объект
+ *
+ * Объект первого порядка моделируется интегратором с обратной связью.
+ */
+template <typename T>
+class Loop
+{
+private:
+    LookupTable1D<T, 4, NullMutex> schedule{{T(0.0), T(1.0), T(2.0), T(3.0)},
+                                            {T(1.0), T(0.8), T(0.6), T(0.5)}};
+    PID<T, NullMutex> pid{T(2.0), T(0.8), T(0.05)};
+    SaturationBlock<T, NullMutex> saturation{T(-1.5), T(1.5)};
+    RateLimiter<T, NullMutex> actuator{T(4.0), T(-4.0)};
+    IntegratorBlock<T, NullMutex> plant{T(-100.0), T(100.0)};
+    T dt;
+
+public:
+    explicit Loop(double step)
+        : dt{T(step)}
+    {
+    }
+
+    T step(const T& reference)
+    {
+        const T output = plant.getOutput();
+        schedule.interpolate(output);
+        pid.step((reference - output) * schedule.getOutput(), dt);
+        saturation.step(pid.getOutput());
+        actuator.step(saturation.getOutput(), dt);
+        plant.step(actuator.getOutput() - T(0.5) * output, dt);
+        return plant.getOutput();
+    }
+};
+
+/**
+ * @brief Время шага контура и его выходы
+ */
+template <typename T>
+double run(const std::vector<double>& references, double dt, std::vector<double>& outputs)
+{
+    std::vector<T> converted(references.size());
+    std::transform(references.begin(), references.end(), converted.begin(), [](double r) { return T(r); });
+
+    return Benchmark::nanosecondsPerOperation(references.size(), [&]
+    {
+        Loop<T> loop(dt);
+        for (std::size_t i = 0; i < converted.size(); i++)
+        {
+            outputs[i] = static_cast<double>(loop.step(converted[i]));
+        }
+        Benchmark::doNotOptimize(outputs.back());
+    });
+}
+
+/**
+ * @brief Наибольшее отклонение выходов от контура в double
+ */
+double maxDeviation(const std::vector<double>& reference, const std::vector<double>& outputs)
+{
+    double result = 0.0;
+    for (std::size_t i = 0; i < reference.size(); i++)
+    {
+        result = std::max(result, std::fabs(outputs[i] - reference[i]));
+    }
+    return result;
+}
+}
+
+int main()
+{
+    constexpr std::size_t steps = 200000;
+    constexpr double dt = 1.0 / 256;
+
+    std::vector<double> references(steps);
+    for (std::size_t i = 0; i < steps; i++)
+    {
+        const double t = dt * static_cast<double>(i);
+        references[i] = 1.5 + std::sin(0.5 * t) + (std::fmod(t, 40.0) < 20.0 ? 0.5 : -0.5);
+    }
+
+    std::vector<double> doubleOutputs(steps);
+    std::vector<double> q16Outputs(steps);
+    std::vector<double> q24Outputs(steps);
+    const double doubleTime = run<double>(references, dt, doubleOutputs);
+    const double q16Time    = run<Fixed<16, 16>>(references, dt, q16Outputs);
+    const double q24Time    = run<Fixed<8, 24>>(references, dt, q24Outputs);
+
+    Benchmark::printHeader("Control loop, ns per step", "double", "fixed");
+    Benchmark::printRow("Fixed<16, 16>", doubleTime, q16Time);
+    Benchmark::printRow("Fixed<8, 24>", doubleTime, q24Time);
+
+    const double q16Error = maxDeviation(doubleOutputs, q16Outputs);
+    const double q24Error = maxDeviation(doubleOutputs, q24Outputs);
+    std::cout << std::endl << "Max deviation from double over " << steps << " steps" << std::endl
+              << std::scientific << std::setprecision(2)
+              << "Fixed<16, 16>: " << q16Error << " (" << std::fixed << q16Error * 65536 << " LSB)" << std::endl
+              << std::scientific
+              << "Fixed<8, 24>:  " << q24Error << " (" << std::fixed << q24Error * 16777216 << " LSB)" << std::endl;
+    return 0;
+}
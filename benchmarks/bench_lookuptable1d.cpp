@@ -0,0 +1,134 @@
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/LookupTable1D.hpp"
+
+using namespace SimulinkBlock;
+
+
+/**
+ * @brief Сравнить поэлементную и пакетную интерполяцию для таблицы из N точек
+ */
+template <std::size_t N>
+void benchmarkTable(const std::vector<double>& samples, bool uniformBreakpoints)
+{
+    std::array<double, N> x;
+    std::array<double, N> y;
+    for (std::size_t i = 0; i < N; i++)
+    {
+        double position = static_cast<double>(i);
+        x[i] = uniformBreakpoints ? position : position + 0.3 * std::sin(position);
+        y[i] = std::cos(0.01 * position);
+    }
+
+    // Большие таблицы не помещаются на стек
+    auto table = std::make_unique<LookupTable1D<double, N, NullMutex>>(x, y);
+
+    // Входы охватывают таблицу и выходят за её пределы с обеих сторон
+    std::vector<double> inputs(samples.size());
+    for (std::size_t i = 0; i < samples.size(); i++)
+    {
+        inputs[i] = -1.0 + samples[i] * (static_cast<double>(N) + 1.0);
+    }
+    std::vector<double> outputs(samples.size());
+
+    double scalar = Benchmark::nanosecondsPerOperation(inputs.size(), [&]
+    {
+        for (std::size_t i = 0; i < inputs.size(); i++)
+        {
+            table->interpolate(inputs[i]);
+            outputs[i] = table->getOutput();
+        }
+        Benchmark::doNotOptimize(outputs.back());
+    });
+
+    double batch = Benchmark::nanosecondsPerOperation(inputs.size(), [&]
+    {
+        table->interpolate(inputs.data(), outputs.data(), inputs.size());
+        Benchmark::doNotOptimize(outputs.back());
+    });
+
+    Benchmark::printRow(std::to_string(N) + (uniformBreakpoints ? " uniform" : " non-uniform"),
+                        scalar, batch);
+}
+
+/**
+ * @brief Сравнить двоичный поиск и поиск с подсказкой на медленно меняющемся входе
+ */
+template <std::size_t N>
+void benchmarkSegmentHint()
+{
+    std::array<double, N> x;
+    std::array<double, N> y;
+    for (std::size_t i = 0; i < N; i++)
+    {
+        double position = static_cast<double>(i);
+        x[i] = position + 0.3 * std::sin(position);
+        y[i] = std::cos(0.01 * position);
+    }
+    auto table = std::make_unique<LookupTable1D<double, N, NullMutex>>(x, y);
+
+    // Вход, похожий на запись скорости полёта: плавное изменение за много шагов
+    std::vector<double> trace(1 << 16);
+    for (std::size_t i = 0; i < trace.size(); i++)
+    {
+        trace[i] = 0.5 * static_cast<double>(N) * (1.0 + std::sin(1e-4 * static_cast<double>(i)));
+    }
+
+    double sink = 0.0;
+    double binarySearch = Benchmark::nanosecondsPerOperation(trace.size(), [&]
+    {
+        for (double value : trace)
+        {
+            table->interpolate(value);
+            sink += table->getOutput();
+        }
+        Benchmark::doNotOptimize(sink);
+    });
+
+    SegmentHint hint;
+    double hunting = Benchmark::nanosecondsPerOperation(trace.size(), [&]
+    {
+        for (double value : trace)
+        {
+            sink += table->interpolate(value, hint);
+        }
+        Benchmark::doNotOptimize(sink);
+    });
+
+    Benchmark::printRow(std::to_string(N) + " hint, hit rate " + std::to_string(hint.hitRate()),
+                        binarySearch, hunting);
+}
+
+template <std::size_t... Sizes>
+void benchmarkSizes(const std::vector<double>& samples, bool uniformBreakpoints)
+{
+    (benchmarkTable<Sizes>(samples, uniformBreakpoints), ...);
+}
+
+int main()
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    std::vector<double> samples(1 << 16);
+    for (auto& sample : samples)
+    {
+        sample = distribution(generator);
+    }
+
+    Benchmark::printHeader("LookupTable1D: ns per sample", "scalar", "batch");
+    for (bool uniformBreakpoints : {true, false})
+    {
+        benchmarkSizes<8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096>(samples, uniformBreakpoints);
+    }
+
+    std::cout << std::endl;
+    Benchmark::printHeader("LookupTable1D: ns per sample on a smooth trace", "search", "hint");
+    benchmarkSegmentHint<64>();
+    benchmarkSegmentHint<4096>();
+    return 0;
+}
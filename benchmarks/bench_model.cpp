@@ -0,0 +1,71 @@
+#include <memory>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/Simulation/Model.hpp"
+
+using namespace SimulinkBlock;
+
+
+/**
+ * @brief Сравнить ручное соединение цепочки блоков с моделью из тех же блоков
+ */
+void benchmarkChain(std::size_t length)
+{
+    constexpr std::size_t steps = 10000;
+    constexpr double dt = 0.001;
+
+    std::vector<std::unique_ptr<IntegratorBlock<double, NullMutex>>> integrators;
+    std::vector<std::unique_ptr<SaturationBlock<double, NullMutex>>> saturations;
+    for (std::size_t i = 0; i < length / 2; i++)
+    {
+        integrators.push_back(std::make_unique<IntegratorBlock<double, NullMutex>>());
+        saturations.push_back(std::make_unique<SaturationBlock<double, NullMutex>>(-1.0, 1.0));
+    }
+
+    double handWired = Benchmark::nanosecondsPerOperation(steps, [&]
+    {
+        for (std::size_t s = 0; s < steps; s++)
+        {
+            double signal = 1.0;
+            for (std::size_t i = 0; i < integrators.size(); i++)
+            {
+                integrators[i]->step(signal, dt);
+                saturations[i]->step(integrators[i]->getOutput());
+                signal = saturations[i]->getOutput();
+            }
+            Benchmark::doNotOptimize(signal);
+        }
+    });
+
+    Model<double> model(dt);
+    Model<double>::OutputPort previous = model.addConstant(1.0).out();
+    for (std::size_t i = 0; i < integrators.size(); i++)
+    {
+        auto integ = model.add(*integrators[i]);
+        auto sat = model.add(*saturations[i]);
+        model.connect(previous, integ.in());
+        model.connect(integ.out(), sat.in());
+        previous = sat.out();
+    }
+    model.compile();
+
+    double scheduled = Benchmark::nanosecondsPerOperation(steps, [&]
+    {
+        for (std::size_t s = 0; s < steps; s++)
+        {
+            model.step();
+        }
+        Benchmark::doNotOptimize(model.signal(previous));
+    });
+
+    Benchmark::printRow(std::to_string(length) + " blocks", handWired, scheduled);
+}
+
+int main()
+{
+    Benchmark::printHeader("Model, ns per model step", "hand-wired", "Model");
+    benchmarkChain(10);
+    benchmarkChain(500);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/FlightControllers/LongitudalControl.hpp"
+#include "../include/Simulation/MonteCarloRunner.hpp"
+
+using namespace SimulinkBlock;
+
+
+namespace
+{
+constexpr std::size_t runs = 2000;  //!< Прогонов в серии
+constexpr int steps = 2000;         //!< Шагов в прогоне (20 с при 100 Гц)
+constexpr double dt = 0.01;         //!< Шаг моделирования
+
+/**
+ * @brief Набор высоты 100 м упрощённой продольной моделью с разбросом аэродинамики
+ */
+struct ClimbScenario
+{
+    std::size_t elevatorGain;  //!< Номер параметра эффективности руля высоты
+    std::size_t pitchDamping;  //!< Номер параметра демпфирования по тангажу
+    std::size_t drag;          //!< Номер параметра сопротивления
+
+    std::array<double, 2> operator()(MonteCarloRun& run) const
+    {
+        LongitudalControl<double, NullMutex> controller;
+        controller.setAltitudePidCoeffs(0.02, 0.001, 0.0);
+        controller.setPitchAnglePidCoeffs(2.0, 0.1, 0.0);
+        controller.setAngularVelocityPidCoeffs(1.5, 0.0, 0.0);
+        controller.setVelocityPidCoeffs(0.5, 0.05, 0.0);
+        controller.setSaturationLimits(-0.3, 0.3);
+
+        double altitude = 1000.0, velocity = 50.0, pitch = 0.0, rate = 0.0;
+        double ise = 0.0;
+        for (int i = 0; i < steps; i++)
+        {
+            controller.step(1100.0, 50.0, altitude, velocity, pitch, rate, dt);
+            const auto& command = controller.getOutput();
+            rate     += (run.parameter(elevatorGain) * command.first - run.parameter(pitchDamping) * rate) * dt;
+            pitch    += rate * dt;
+            velocity += (5.0 * command.second - run.parameter(drag) * velocity - 9.81 * std::sin(pitch)) * dt;
+            altitude += velocity * std::sin(pitch) * dt;
+            ise      += (1100.0 - altitude) * (1100.0 - altitude) * dt;
+        }
+        return {ise, altitude};
+    }
+};
+}
+
+int main()
+{
+    Dispersion dispersion;
+    const ClimbScenario scenario{dispersion.addNormal("ElevatorGain", 4.0, 0.4),
+                                 dispersion.addUniform("PitchDamping", 1.0, 2.0),
+                                 dispersion.addNormal("Drag", 0.02, 0.002)};
+
+    MonteCarloRunner single(dispersion, {"ISE", "Altitude"}, 1, 1);
+    MonteCarloRunner parallel(dispersion, {"ISE", "Altitude"}, 1);
+    const MonteCarloSummary reference = single.run(runs, scenario);
+    const MonteCarloSummary summary = parallel.run(runs, scenario);
+
+    Benchmark::printHeader("Monte Carlo climb, us per run", "1 thread",
+                           std::to_string(parallel.threadCount()) + " threads");
+    Benchmark::printRow(std::to_string(runs) + " runs x " + std::to_string(steps) + " steps",
+                        1e6 / reference.runsPerSecond(), 1e6 / summary.runsPerSecond());
+    std::cout << "runs/s: " << reference.runsPerSecond() << " -> " << summary.runsPerSecond()
+              << ", final altitude " << summary.metric("Altitude").mean()
+              << " +- " << summary.metric("Altitude").stddev() << " m" << std::endl;
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <memory>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/Simulation/MultiRateScheduler.hpp"
+
+using namespace SimulinkBlock;
+
+
+namespace
+{
+constexpr double plantPeriod = 0.001;  //!< Объект управления, 1 кГц
+constexpr double innerPeriod = 0.01;   //!< Внутренние контуры, 100 Гц
+constexpr double outerPeriod = 0.1;    //!< Внешние контуры, 10 Гц
+
+/**
+ * @brief Блоки одной группы: цепочка из count регуляторов от постоянного входа
+ */
+void addControllers(Model<double>& model, std::vector<std::unique_ptr<PID<double, NullMutex>>>& blocks, std::size_t count)
+{
+    auto previous = model.addConstant(1.0).out();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        blocks.push_back(std::make_unique<PID<double, NullMutex>>(0.5, 0.1, 0.01));
+        auto pid = model.add(*blocks.back());
+        model.connect(previous, pid.in());
+        previous = pid.out();
+    }
+}
+
+/**
+ * @brief Все контуры выполняются с шагом объекта управления
+ */
+double singleRate(std::size_t count, std::size_t ticks)
+{
+    std::vector<std::unique_ptr<PID<double, NullMutex>>> blocks;
+    Model<double> model(plantPeriod);
+    addControllers(model, blocks, 3 * count);
+    model.compile();
+
+    return Benchmark::nanosecondsPerOperation(ticks, [&]
+    {
+        for (std::size_t i = 0; i < ticks; i++)
+        {
+            model.step();
+        }
+    });
+}
+
+/**
+ * @brief Контуры выполняются со своими периодами
+ */
+double multiRate(std::size_t count, std::size_t ticks, MultiRateScheduler<double>::Execution execution)
+{
+    std::vector<std::unique_ptr<PID<double, NullMutex>>> blocks;
+    MultiRateScheduler<double> scheduler(plantPeriod);
+    addControllers(scheduler.model(scheduler.addRate(plantPeriod)), blocks, count);
+    addControllers(scheduler.model(scheduler.addRate(innerPeriod, execution)), blocks, count);
+    addControllers(scheduler.model(scheduler.addRate(outerPeriod, execution)), blocks, count);
+    scheduler.compile();
+
+    return Benchmark::nanosecondsPerOperation(ticks, [&]
+    {
+        for (std::size_t i = 0; i < ticks; i++)
+        {
+            scheduler.step();
+        }
+        scheduler.synchronize();
+    });
+}
+}
+
+int main()
+{
+    using Execution = MultiRateScheduler<double>::Execution;
+    constexpr std::size_t ticks = 10000;
+
+    Benchmark::printHeader("1 kHz / 100 Hz / 10 Hz groups, ns per base tick", "single rate", "multi-rate");
+    for (std::size_t count : {10, 1000})
+    {
+        const double baseline = singleRate(count, ticks);
+        Benchmark::printRow(std::to_string(3 * count) + " blocks, inline", baseline,
+                            multiRate(count, ticks, Execution::Inline));
+        Benchmark::printRow(std::to_string(3 * count) + " blocks, threads", baseline,
+                            multiRate(count, ticks, Execution::Thread));
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/Simulation/OdeSolver.hpp"
+
+using namespace SimulinkBlock;
+
+
+namespace
+{
+constexpr double maneuverTime = 20.0;   //!< Длительность манёвра
+constexpr double flightTime = 3600.0;   //!< Длительность полёта
+
+/**
+ * @brief Линейная продольная модель: короткопериодическое движение и фугоида
+ *
+ * Состояния: угловая скорость и угол тангажа (собственная частота 3 рад/с),
+ * отклонение скорости и высоты (фугоида, 0.1 рад/с). Руль высоты отклоняется
+ * дублетом на первых секундах полёта.
+ */
+void longitudinal(double t, const double* x, double* dx)
+{
+    const double elevator = t < 1.0 ? 0.05 : (t < 2.0 ? -0.05 : 0.0);
+    dx[0] = -3.0 * x[0] - 9.0 * x[1] + 12.0 * elevator;
+    dx[1] = x[0];
+    dx[2] = -0.001 * x[2] - 0.01 * x[3] - 9.81 * x[1];
+    dx[3] = x[2];
+}
+
+struct Run
+{
+    double seconds;      //!< Время моделирования
+    std::size_t steps;   //!< Количество шагов
+    double altitude;     //!< Отклонение высоты в конце полёта
+};
+
+Run fixedStep(double dt)
+{
+    OdeSolver<double> solver(4, SolverOptions{SolverMethod::Euler});
+    double x[4] = {0.0, 0.0, 0.0, 0.0};
+    double t = 0.0;
+    const auto steps = static_cast<long long>(std::llround(flightTime / dt));
+    const auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < steps; i++)
+    {
+        solver.advance(longitudinal, t, x, dt);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(stop - start).count(), solver.statistics().steps, x[3]};
+}
+
+Run adaptive(double tolerance)
+{
+    SolverOptions options{SolverMethod::DormandPrince};
+    options.relativeTolerance = tolerance;
+    options.absoluteTolerance = tolerance * 1e-3;
+    OdeSolver<double> solver(4, options);
+    double x[4] = {0.0, 0.0, 0.0, 0.0};
+    double t = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    // Разрывы входа попадают на границы интервалов
+    solver.advance(longitudinal, t, x, 1.0);
+    solver.advance(longitudinal, t, x, 1.0);
+    solver.advance(longitudinal, t, x, maneuverTime - 2.0);
+    solver.advance(longitudinal, t, x, flightTime - maneuverTime);
+    const auto stop = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(stop - start).count(), solver.statistics().steps, x[3]};
+}
+}
+
+int main()
+{
+    const double reference = adaptive(1e-12).altitude;
+    const Run euler = fixedStep(0.001);
+    const Run dormandPrince = adaptive(1e-6);
+
+    Benchmark::printHeader("1 h longitudinal flight, ms per run", "Euler 1 ms", "DP5(4) 1e-6");
+    Benchmark::printRow("4 states", euler.seconds * 1e3, dormandPrince.seconds * 1e3);
+    std::cout << std::scientific << "steps: " << euler.steps << " -> " << dormandPrince.steps
+              << ", altitude error: " << std::fabs(euler.altitude - reference)
+              << " -> " << std::fabs(dormandPrince.altitude - reference) << " m" << std::endl;
+    return 0;
+}
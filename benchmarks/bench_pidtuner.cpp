@@ -0,0 +1,78 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/Simulation/PidTuner.hpp"
+
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Модель угловой скорости по тангажу: q' = (4 * u - 1.5 * q), выход - угол
+ */
+auto makePitchPlant()
+{
+    return []
+    {
+        return [pitch = 0.0, rate = 0.0](double control, double dt) mutable
+        {
+            rate  += (4.0 * control - 1.5 * rate) * dt;
+            pitch += rate * dt;
+            return pitch;
+        };
+    };
+}
+
+std::vector<double> linspace(double first, double last, std::size_t count)
+{
+    std::vector<double> values(count);
+    for (std::size_t k = 0; k < count; k++)
+    {
+        values[k] = first + (last - first) * static_cast<double>(k) / static_cast<double>(count - 1);
+    }
+    return values;
+}
+
+/**
+ * @brief Время перебора сетки 16 x 16 x 16 в микросекундах на кандидата
+ */
+double gridMicroseconds(bool earlyTermination, std::size_t& simulatedSteps, TuningResult& best)
+{
+    TuningOptions options;
+    options.duration = 20.0;
+    options.itaeWeight = 0.1;
+    options.overshootWeight = 5.0;
+    options.earlyTermination = earlyTermination;
+    PidTuner tuner(makePitchPlant(), options);
+
+    const auto p = linspace(0.0, 30.0, 16);
+    const auto i = linspace(0.0, 10.0, 16);
+    const auto d = linspace(0.0, 3.0, 16);
+    const auto start = std::chrono::steady_clock::now();
+    best = tuner.gridSearch(p, i, d).front();
+    const auto stop = std::chrono::steady_clock::now();
+
+    simulatedSteps = tuner.simulatedSteps();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(tuner.evaluationCount());
+}
+}
+
+int main()
+{
+    std::size_t fullSteps = 0;
+    std::size_t prunedSteps = 0;
+    TuningResult fullBest;
+    TuningResult prunedBest;
+    const double full = gridMicroseconds(false, fullSteps, fullBest);
+    const double pruned = gridMicroseconds(true, prunedSteps, prunedBest);
+
+    Benchmark::printHeader("PID grid search 16^3, us per candidate", "full", "early stop");
+    Benchmark::printRow("2000-step pitch response", full, pruned);
+    std::cout << "simulated steps: " << fullSteps << " -> " << prunedSteps
+              << ", best gains " << prunedBest.gains.p << ' ' << prunedBest.gains.i << ' ' << prunedBest.gains.d
+              << " (same as full: " << (prunedBest.cost == fullBest.cost ? "yes" : "no") << ")" << std::endl;
+    return 0;
+}
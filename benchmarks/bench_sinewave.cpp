@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/SineWaveGenerator.hpp"
+
+using namespace SimulinkBlock;
+
+
+/**
+ * @brief Сравнить вычисление по времени и режим с постоянным шагом
+ */
+void benchmarkFixedStep()
+{
+    constexpr std::size_t steps = 1000000;
+    constexpr double dt = 1e-4;
+
+    SineWaveGenerator<double, double, NullMutex> timeBased(1.0, 50.0, 0.0);
+    SineWaveGenerator<double, double, NullMutex> incremental(1.0, 50.0, 0.0);
+
+    double scalar = Benchmark::nanosecondsPerOperation(steps, [&]
+    {
+        for (std::size_t i = 0; i < steps; i++)
+        {
+            timeBased.step(static_cast<double>(i) * dt);
+            Benchmark::doNotOptimize(timeBased.getOutput());
+        }
+    });
+
+    double rotation = Benchmark::nanosecondsPerOperation(steps, [&]
+    {
+        incremental.setFixedStep(dt);
+        for (std::size_t i = 0; i < steps; i++)
+        {
+            incremental.step();
+            Benchmark::doNotOptimize(incremental.getOutput());
+        }
+    });
+
+    Benchmark::printRow("step(time) vs step()", scalar, rotation);
+}
+
+/**
+ * @brief Сравнить поэлементный цикл step(time) и заполнение буфера generate
+ */
+void benchmarkGenerate(std::size_t samples)
+{
+    constexpr double dt = 1e-5;
+
+    SineWaveGenerator<double, double> generator(1.0, 50.0, 0.0);
+    std::vector<double> buffer(samples);
+
+    double scalar = Benchmark::nanosecondsPerOperation(samples, [&]
+    {
+        for (std::size_t i = 0; i < samples; i++)
+        {
+            generator.step(static_cast<double>(i) * dt);
+            buffer[i] = generator.getOutput();
+        }
+        Benchmark::doNotOptimize(buffer.back());
+    });
+
+    double batch = Benchmark::nanosecondsPerOperation(samples, [&]
+    {
+        generator.generate(0.0, dt, buffer.data(), buffer.size());
+        Benchmark::doNotOptimize(buffer.back());
+    });
+
+    Benchmark::printRow("generate " + std::to_string(samples), scalar, batch);
+}
+
+/**
+ * @brief Оценить максимальную ошибку обоих режимов за 10^9 шагов
+ *
+ * Эталонная фаза вычисляется в long double из номера шага, поэтому
+ * видна как ошибка накопления времени n * dt, так и дрейф поворота.
+ */
+void measureDrift()
+{
+    constexpr std::uint64_t steps = 1000000000;
+    constexpr std::uint64_t checkEvery = 65537;
+    constexpr double frequency = 50.0;
+    constexpr double dt = 1e-4;
+
+    SineWaveGenerator<double, double, NullMutex> timeBased(1.0, frequency, 0.0);
+    SineWaveGenerator<double, double, NullMutex> incremental(1.0, frequency, 0.0);
+    incremental.setFixedStep(dt);
+
+    const long double cyclesPerStep = frequency * dt;
+    double time = 0.0;
+    double timeBasedError = 0.0;
+    double incrementalError = 0.0;
+    for (std::uint64_t n = 0; n < steps; n++)
+    {
+        incremental.step();
+        if (n % checkEvery == 0)
+        {
+            long double cycles = cyclesPerStep * static_cast<long double>(n);
+            cycles -= std::floor(cycles);
+            double expected = static_cast<double>(std::sin(2.0L * static_cast<long double>(M_PI) * cycles));
+
+            timeBased.step(time);
+            timeBasedError = std::max(timeBasedError, std::abs(timeBased.getOutput() - expected));
+            incrementalError = std::max(incrementalError, std::abs(incremental.getOutput() - expected));
+        }
+        // Время накапливается так же, как в типичном цикле моделирования
+        time += dt;
+    }
+
+    std::cout << "max error over " << steps << " steps: step(time) "
+              << std::scientific << timeBasedError
+              << ", step() " << incrementalError << std::defaultfloat << std::endl;
+}
+
+int main()
+{
+    Benchmark::printHeader("SineWaveGenerator, ns per sample", "time", "rotation");
+    benchmarkFixedStep();
+    std::cout << std::endl;
+
+    Benchmark::printHeader("SineWaveGenerator, ns per sample", "step(time)", "generate");
+    benchmarkGenerate(1024);
+    benchmarkGenerate(1000000);
+    std::cout << std::endl;
+    measureDrift();
+    return 0;
+}
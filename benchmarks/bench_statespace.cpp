@@ -0,0 +1,203 @@
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/DiscreteStateSpace.hpp"
+#include "../include/DiscreteTransferFcn.hpp"
+#include "../include/IntegratorBlock.hpp"
+
+using namespace SimulinkBlock;
+
+namespace
+{
+constexpr double dt = 0.01;
+
+// Две связанные колебательные моды (короткопериодическое движение и фугоид),
+// дискретизированные методом Эйлера: x' = F x + G u, A = I + F dt, B = G dt
+constexpr double f[4][4] = {{-2.0, 1.0, 0.0, 0.0},
+                            {-9.0, -1.5, 0.0, 0.0},
+                            {0.0, 0.3, -0.01, -9.81},
+                            {0.0, 0.0, 0.002, 0.0}};
+constexpr double g[4] = {-0.2, -12.0, 0.0, 0.0};
+
+/**
+ * @brief Модель из четырёх IntegratorBlock и коэффициентов, как в FlightControllers
+ */
+double integratorBlocks(const std::vector<double>& inputs)
+{
+    IntegratorBlock<double> x0, x1, x2, x3;
+
+    return Benchmark::nanosecondsPerOperation(inputs.size(), [&]
+    {
+        for (double u : inputs)
+        {
+            const double s0 = x0.getOutput();
+            const double s1 = x1.getOutput();
+            const double s2 = x2.getOutput();
+            const double s3 = x3.getOutput();
+            x0.step(f[0][0] * s0 + f[0][1] * s1 + g[0] * u, dt);
+            x1.step(f[1][0] * s0 + f[1][1] * s1 + g[1] * u, dt);
+            x2.step(f[2][1] * s1 + f[2][2] * s2 + f[2][3] * s3, dt);
+            x3.step(f[3][2] * s2, dt);
+            Benchmark::doNotOptimize(x0.getOutput());
+            Benchmark::doNotOptimize(x3.getOutput());
+        }
+    });
+}
+
+Matrix<double, 4, 4> stateMatrix()
+{
+    Matrix<double, 4, 4> a{};
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            a[i][j] = (i == j ? 1.0 : 0.0) + f[i][j] * dt;
+        }
+    }
+    return a;
+}
+
+const Matrix<double, 4, 1> inputMatrix{{{g[0] * dt}, {g[1] * dt}, {g[2] * dt}, {g[3] * dt}}};
+const Matrix<double, 2, 4> outputMatrix{{{1.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 1.0}}};
+
+/**
+ * @brief Та же модель одним блоком DiscreteStateSpace
+ */
+double stateSpace(const std::vector<double>& inputs)
+{
+    DiscreteStateSpace<double, 4, 1, 2> plant{stateMatrix(), inputMatrix, outputMatrix};
+
+    return Benchmark::nanosecondsPerOperation(inputs.size(), [&]
+    {
+        for (double u : inputs)
+        {
+            plant.step({u});
+            Benchmark::doNotOptimize(plant.getOutput());
+        }
+    });
+}
+
+/**
+ * @brief lanes отдельных блоков DiscreteStateSpace, ns на систему
+ */
+double separateSystems(std::size_t lanes, std::size_t steps)
+{
+    std::vector<DiscreteStateSpace<double, 4, 1, 2, NullMutex>> plants(lanes, {stateMatrix(), inputMatrix, outputMatrix});
+    std::vector<double> inputs(lanes);
+    for (std::size_t lane = 0; lane < lanes; lane++)
+    {
+        inputs[lane] = std::sin(static_cast<double>(lane));
+    }
+
+    return Benchmark::nanosecondsPerOperation(lanes * steps, [&]
+    {
+        for (std::size_t k = 0; k < steps; k++)
+        {
+            for (std::size_t lane = 0; lane < lanes; lane++)
+            {
+                plants[lane].step({inputs[lane]});
+            }
+        }
+        Benchmark::doNotOptimize(plants[0].getOutput());
+    });
+}
+
+/**
+ * @brief Банк из lanes систем с общими матрицами, ns на систему
+ */
+double stateSpaceBank(std::size_t lanes, std::size_t steps)
+{
+    DiscreteStateSpaceBank<double, 4, 1, 2, NullMutex> bank{lanes, stateMatrix(), inputMatrix, outputMatrix};
+    std::vector<double> inputs(lanes);
+    for (std::size_t lane = 0; lane < lanes; lane++)
+    {
+        inputs[lane] = std::sin(static_cast<double>(lane));
+    }
+
+    return Benchmark::nanosecondsPerOperation(lanes * steps, [&]
+    {
+        for (std::size_t k = 0; k < steps; k++)
+        {
+            bank.step(inputs);
+        }
+        Benchmark::doNotOptimize(bank.getOutputs()[0]);
+    });
+}
+
+// Фильтр Баттерворта 4-го порядка с частотой среза 0.1 от частоты Найквиста
+const DiscreteTransferFcn<double, 4>::Coefficients butterNum{0.0000416599, 0.000166640, 0.000249959, 0.000166640, 0.0000416599};
+const DiscreteTransferFcn<double, 4>::Coefficients butterDen{1.0, -3.5897338, 4.8512758, -2.9240526, 0.6630044};
+
+/**
+ * @brief lanes отдельных фильтров DiscreteTransferFcn, ns на фильтр
+ */
+double separateFilters(std::size_t lanes, std::size_t steps)
+{
+    std::vector<DiscreteTransferFcn<double, 4, NullMutex>> filters(lanes, {butterNum, butterDen});
+    std::vector<double> inputs(lanes);
+    for (std::size_t lane = 0; lane < lanes; lane++)
+    {
+        inputs[lane] = std::sin(static_cast<double>(lane));
+    }
+
+    return Benchmark::nanosecondsPerOperation(lanes * steps, [&]
+    {
+        for (std::size_t k = 0; k < steps; k++)
+        {
+            for (std::size_t lane = 0; lane < lanes; lane++)
+            {
+                filters[lane].step(inputs[lane]);
+            }
+        }
+        Benchmark::doNotOptimize(filters[0].getOutput());
+    });
+}
+
+/**
+ * @brief Банк из lanes фильтров, ns на фильтр
+ */
+double transferFcnBank(std::size_t lanes, std::size_t steps)
+{
+    DiscreteTransferFcnBank<double, 4, NullMutex> bank{lanes, butterNum, butterDen};
+    std::vector<double> inputs(lanes);
+    for (std::size_t lane = 0; lane < lanes; lane++)
+    {
+        inputs[lane] = std::sin(static_cast<double>(lane));
+    }
+
+    return Benchmark::nanosecondsPerOperation(lanes * steps, [&]
+    {
+        for (std::size_t k = 0; k < steps; k++)
+        {
+            bank.step(inputs);
+        }
+        Benchmark::doNotOptimize(bank.getOutputs()[0]);
+    });
+}
+}
+
+int main()
+{
+    constexpr std::size_t steps = 1000000;
+    std::vector<double> inputs(steps);
+    for (std::size_t i = 0; i < steps; i++)
+    {
+        inputs[i] = std::sin(0.01 * static_cast<double>(i));
+    }
+
+    Benchmark::printHeader("4-state plant, ns per step", "integrators", "state-space");
+    Benchmark::printRow("std::mutex", integratorBlocks(inputs), stateSpace(inputs));
+
+    std::cout << std::endl;
+    Benchmark::printHeader("Shared matrices, ns per system step", "separate", "bank");
+    for (std::size_t lanes : {64, 1024})
+    {
+        Benchmark::printRow("state-space, " + std::to_string(lanes) + " systems",
+                            separateSystems(lanes, 1000), stateSpaceBank(lanes, 1000));
+        Benchmark::printRow("transfer fcn, " + std::to_string(lanes) + " filters",
+                            separateFilters(lanes, 1000), transferFcnBank(lanes, 1000));
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/WhiteNoiseGenerator.hpp"
+
+using namespace SimulinkBlock;
+
+
+/**
+ * @brief Сравнить std::normal_distribution под мьютексом с step() и fill()
+ */
+template <typename Engine>
+void benchmarkNoise(const std::string& name, std::size_t samples)
+{
+    std::vector<double> buffer(samples);
+
+    // Прежняя реализация блока: одно число распределения под мьютексом на шаг
+    std::mutex mtx;
+    Engine engine;
+    std::normal_distribution<double> distribution(0.0, 1.0);
+    double reference = Benchmark::nanosecondsPerOperation(samples, [&]
+    {
+        for (std::size_t i = 0; i < samples; i++)
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            buffer[i] = distribution(engine);
+        }
+        Benchmark::doNotOptimize(buffer.back());
+    });
+
+    WhiteNoiseGenerator<double, std::mutex, Engine> generator(0.0, 1.0, Engine());
+    double stepping = Benchmark::nanosecondsPerOperation(samples, [&]
+    {
+        for (std::size_t i = 0; i < samples; i++)
+        {
+            generator.step();
+            buffer[i] = generator.getOutput();
+        }
+        Benchmark::doNotOptimize(buffer.back());
+    });
+
+    double filling = Benchmark::nanosecondsPerOperation(samples, [&]
+    {
+        generator.fill(buffer.data(), buffer.size());
+        Benchmark::doNotOptimize(buffer.back());
+    });
+
+    Benchmark::printRow(name + " step()", reference, stepping);
+    Benchmark::printRow(name + " fill()", reference, filling);
+}
+
+int main()
+{
+    Benchmark::printHeader("WhiteNoiseGenerator, ns per sample", "normal_dist", "block");
+    benchmarkNoise<std::mt19937>("mt19937", 1000000);
+    benchmarkNoise<Philox4x32>("Philox4x32", 1000000);
+    return 0;
+}
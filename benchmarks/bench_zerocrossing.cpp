@@ -0,0 +1,121 @@
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include "BenchmarkUtils.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/Simulation/ContinuousModel.hpp"
+
+using namespace SimulinkBlock;
+
+
+namespace
+{
+constexpr double gravity = 9.81;     //!< Ускорение свободного падения
+constexpr double dropHeight = 10.0;  //!< Начальная высота мяча
+constexpr double restitution = 0.5;  //!< Коэффициент восстановления скорости при отскоке
+constexpr double duration = 4.0;     //!< Длительность моделирования
+
+/**
+ * @brief Момент второго отскока
+ */
+double exactSecondBounce()
+{
+    const double first = std::sqrt(2 * dropHeight / gravity);
+    return first + 2 * restitution * first;
+}
+
+/**
+ * @brief Отскоки, обнаруживаемые сравнением высоты в моменты шагов блоков
+ *
+ * Чтобы найти момент события с точностью шага, шаг приходится уменьшать.
+ */
+double sampledSecondBounce(double dt)
+{
+    IntegratorBlock<double, NullMutex> height;
+    IntegratorBlock<double, NullMutex> velocity;
+    height.setState(dropHeight);
+    int bounces = 0;
+    double second = 0.0;
+    const long steps = std::lround(duration / dt);
+    for (long k = 1; k <= steps; k++)
+    {
+        const double v = velocity.getOutput();
+        velocity.step(-gravity, dt);
+        height.step(v, dt);
+        if (height.getOutput() <= 0.0 && velocity.getOutput() < 0.0)
+        {
+            velocity.setState(-restitution * velocity.getOutput());
+            if (++bounces == 2)
+            {
+                second = k * dt;
+            }
+        }
+    }
+    return second;
+}
+
+/**
+ * @brief Отскоки, найденные функцией пересечения нуля при крупном шаге модели
+ */
+double localizedSecondBounce(double dt)
+{
+    IntegratorBlock<double, NullMutex> height;
+    IntegratorBlock<double, NullMutex> velocity;
+    height.setState(dropHeight);
+
+    ContinuousModel<double> model;
+    model.addState(height);
+    model.addState(velocity);
+    model.setDerivatives([](double, const double* x, double* dx)
+    {
+        dx[0] = x[1];
+        dx[1] = -gravity;
+    });
+    int bounces = 0;
+    double second = 0.0;
+    model.addZeroCrossing([](double, const double* x) { return x[0]; }, CrossingDirection::Falling,
+                          [&](double time, double* x)
+                          {
+                              x[1] = -restitution * x[1];
+                              if (++bounces == 2)
+                              {
+                                  second = time;
+                              }
+                          });
+    const long steps = std::lround(duration / dt);
+    for (long k = 0; k < steps; k++)
+    {
+        model.advance(dt);
+    }
+    return second;
+}
+}
+
+int main()
+{
+    const double exact = exactSecondBounce();
+    double sampled = 0.0;
+    double localized = 0.0;
+    // Шаги читаются через volatile, чтобы прогон не был вычислен один раз вне цикла измерений
+    volatile double sampledStep = 1e-5;
+    volatile double modelStep = 0.1;
+
+    const double sampledTime = Benchmark::nanosecondsPerOperation(1, [&]
+    {
+        sampled = sampledSecondBounce(sampledStep);
+        Benchmark::doNotOptimize(sampled);
+    });
+    const double localizedTime = Benchmark::nanosecondsPerOperation(1, [&]
+    {
+        localized = localizedSecondBounce(modelStep);
+        Benchmark::doNotOptimize(localized);
+    });
+
+    Benchmark::printHeader("Bouncing ball, 4 s, us", "sampled", "located");
+    Benchmark::printRow("dt 1e-5 vs 0.1 + zero crossing", sampledTime / 1000.0, localizedTime / 1000.0);
+    std::cout << std::endl << std::scientific << std::setprecision(2)
+              << "second bounce error: sampled " << std::fabs(sampled - exact)
+              << " s, located " << std::fabs(localized - exact) << " s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+#include "WhiteNoiseGenerator.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Класс, реализующий блок Band-Limited White Noise
+ *
+ * Нормальный шум с нулевым средним и дисперсией noisePower / sampleTime,
+ * удерживаемый на интервале sampleTime. Новое значение берётся только при
+ * переходе времени в следующий интервал, поэтому генератор вызывается
+ * реже шага решателя во столько раз, во сколько sampleTime больше этого шага.
+ * Значения вычисляются пачками по batchSize отсчётов (WhiteNoiseGenerator::fill).
+ *
+ * Значение на интервале k равно k-му отсчёту последовательности, поэтому при
+ * одинаковом генераторе выход не зависит от шага решателя: пропущенные
+ * интервалы пропускаются и в последовательности.
+ *
+ * @tparam T Тип выходного значения и времени
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ * @tparam Engine Генератор случайных битов (std::mt19937, Philox4x32 и т.п.)
+ */
+template <typename T, typename Mutex = std::mutex, typename Engine = std::mt19937>
+class BandLimitedWhiteNoise
+{
+public:
+    static constexpr T timeTolerance = T(1e-9); //!< Допуск попадания на границу интервала (в долях sampleTime)
+
+private:
+    Mutex mtx;                                       //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    WhiteNoiseGenerator<T, NullMutex, Engine> noise; //!< Генератор нормальных отсчётов с масштабом sqrt(noisePower / sampleTime)
+    T sampleTime;                                    //!< Интервал удержания
+    std::vector<T> batch;                            //!< Заранее вычисленные отсчёты
+    std::size_t position;                            //!< Количество использованных отсчётов пачки
+    std::int64_t sampleIndex = 0;                    //!< Номер текущего интервала
+    bool started = false;                            //!< Получено ли первое значение
+    std::uint64_t drawCount = 0;                     //!< Количество использованных отсчётов
+    T output = T(0);                                 //!< Выходное значение
+
+public:
+    /**
+     * @brief Конструктор блока с генератором, инициализированным из std::random_device
+     *
+     * @param noisePower Мощность шума (высота спектральной плотности)
+     * @param sampleTime Интервал удержания
+     * @param batchSize Количество отсчётов, вычисляемых за один раз
+     */
+    BandLimitedWhiteNoise(T noisePower, T sampleTime, std::size_t batchSize = 64)
+        : noise(T(0), scale(noisePower, sampleTime)),
+        sampleTime{sampleTime}, batch(checkBatch(batchSize)), position{batchSize}
+    {
+    }
+
+    /**
+     * @brief Конструктор блока с заданным генератором для воспроизводимых последовательностей
+     *
+     * @param noisePower Мощность шума (высота спектральной плотности)
+     * @param sampleTime Интервал удержания
+     * @param engine Генератор случайных битов, например Philox4x32(seed, stream)
+     * @param batchSize Количество отсчётов, вычисляемых за один раз
+     */
+    BandLimitedWhiteNoise(T noisePower, T sampleTime, const Engine& engine, std::size_t batchSize = 64)
+        : noise(T(0), scale(noisePower, sampleTime), engine),
+        sampleTime{sampleTime}, batch(checkBatch(batchSize)), position{batchSize}
+    {
+    }
+
+    /**
+     * @brief Выполнить шаг блока в момент времени time
+     *
+     * @param time Текущее время моделирования
+     */
+    void step(const T& time)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        const auto index = static_cast<std::int64_t>(std::floor(time / sampleTime + timeTolerance));
+        if (started && index == sampleIndex)
+        {
+            return;
+        }
+
+        // При переходе вперёд через несколько интервалов их отсчёты пропускаются
+        std::uint64_t draws = (started && index > sampleIndex) ? static_cast<std::uint64_t>(index - sampleIndex) : 1;
+        drawCount += draws;
+        while (draws > 0)
+        {
+            if (position == batch.size())
+            {
+                noise.fill(batch.data(), batch.size());
+                position = 0;
+            }
+            const std::size_t available = batch.size() - position;
+            const std::size_t taken = draws < available ? static_cast<std::size_t>(draws) : available;
+            position += taken;
+            draws    -= taken;
+        }
+
+        output      = batch[position - 1];
+        sampleIndex = index;
+        started     = true;
+    }
+
+    /**
+     * @brief Количество отсчётов генератора, использованных с момента создания
+     */
+    std::uint64_t getDrawCount()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return drawCount;
+    }
+
+    /**
+     * @brief Получить ссылку на выходное значение блока
+     *
+     * @return Ссылка на выходное значение
+     */
+    const T& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить выход блока; следующий шаг возьмёт новое значение
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output  = T(0);
+        started = false;
+    }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        noise.saveState(out);
+        out.write(batch.data(), batch.size());
+        out.write(static_cast<std::uint64_t>(position));
+        out.write(sampleIndex);
+        out.write(started);
+        out.write(drawCount);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        noise.restoreState(in);
+        in.read(batch.data(), batch.size());
+        const std::uint64_t restoredPosition = in.read<std::uint64_t>();
+        if (restoredPosition > batch.size())
+        {
+            throw std::invalid_argument("Checkpoint does not match the object layout");
+        }
+        position = static_cast<std::size_t>(restoredPosition);
+        in.read(sampleIndex);
+        in.read(started);
+        in.read(drawCount);
+        in.read(output);
+    }
+
+private:
+    /**
+     * @brief Среднеквадратическое отклонение sqrt(noisePower / sampleTime)
+     */
+    static T scale(T noisePower, T sampleTime)
+    {
+        if (!(sampleTime > T(0)))
+        {
+            throw std::invalid_argument("Sample time should be positive");
+        }
+        if (noisePower < T(0))
+        {
+            throw std::invalid_argument("Noise power should not be negative");
+        }
+        return std::sqrt(noisePower / sampleTime);
+    }
+
+    /**
+     * @brief Проверить размер пачки
+     */
+    static std::size_t checkBatch(std::size_t batchSize)
+    {
+        if (batchSize == 0)
+        {
+            throw std::invalid_argument("Batch size should be positive");
+        }
+        return batchSize;
+    }
+};
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace SimulinkBlock
+{
+namespace detail
+{
+/**
+ * @brief Признак наличия у блока метода process(input, dt)
+ */
+template <typename Block, typename T, typename Dt, typename = void>
+struct HasTimedProcess : std::false_type
+{
+};
+
+template <typename Block, typename T, typename Dt>
+struct HasTimedProcess<Block, T, Dt,
+    std::void_t<decltype(std::declval<Block&>().process(std::declval<const T&>(), std::declval<const Dt&>()))>>
+    : std::true_type
+{
+};
+
+/**
+ * @brief Выполнить одно звено цепочки: process(input, dt) или process(input)
+ */
+template <typename Block, typename T, typename Dt>
+auto processStage(Block& block, const T& input, const Dt& dt)
+{
+    if constexpr (HasTimedProcess<Block, T, Dt>::value)
+    {
+        return block.process(input, dt);
+    }
+    else
+    {
+        return block.process(input);
+    }
+}
+}
+
+/**
+ * @brief Последовательное соединение блоков с объединённой функцией шага
+ *
+ * Выход каждого блока подаётся на вход следующего. step() вызывает методы
+ * process() блоков подряд, поэтому промежуточные сигналы не записываются в
+ * выходы блоков, а мьютексы блоков не захватываются: компилятор встраивает
+ * всю цепочку в одну функцию, и промежуточные значения остаются в регистрах.
+ *
+ * Цепочка хранит ссылки на блоки и не синхронизирует доступ к ним: блоки
+ * должны использоваться только через цепочку в одном потоке. Выход блоков
+ * без собственного состояния (SaturationBlock, DerivativeBlock, LookupTable1D)
+ * через getOutput() при этом не обновляется; выход цепочки возвращает step().
+ *
+ * @tparam Blocks Типы блоков в порядке прохождения сигнала
+ */
+template <typename... Blocks>
+class Chain
+{
+    static_assert(sizeof...(Blocks) > 0, "Chain should contain at least one block");
+
+private:
+    std::tuple<Blocks&...> blocks; //!< Блоки цепочки
+
+public:
+    explicit Chain(Blocks&... chainBlocks)
+        : blocks{chainBlocks...}
+    {
+    }
+
+    /**
+     * @brief Выполнить шаг всех блоков цепочки
+     *
+     * Блоки без параметра dt (SaturationBlock, LookupTable1D) его не получают.
+     *
+     * @param input Входное значение первого блока
+     * @param dt Временной шаг
+     * @return Выходное значение последнего блока
+     */
+    template <typename T, typename Dt>
+    auto step(const T& input, const Dt& dt)
+    {
+        return stage<0>(input, dt);
+    }
+
+    /**
+     * @brief Количество блоков в цепочке
+     */
+    static constexpr std::size_t size()
+    {
+        return sizeof...(Blocks);
+    }
+
+private:
+    template <std::size_t I, typename T, typename Dt>
+    auto stage(const T& input, const Dt& dt)
+    {
+        if constexpr (I + 1 == sizeof...(Blocks))
+        {
+            return detail::processStage(std::get<I>(blocks), input, dt);
+        }
+        else
+        {
+            return stage<I + 1>(detail::processStage(std::get<I>(blocks), input, dt), dt);
+        }
+    }
+};
+
+/**
+ * @brief Соединить блоки последовательно
+ *
+ * Пример: auto fused = chain(integrator, saturation, rateLimiter);
+ *         double y = fused.step(u, dt);
+ *
+ * @param blocks Блоки в порядке прохождения сигнала
+ * @return Цепочка, хранящая ссылки на блоки
+ */
+template <typename... Blocks>
+Chain<Blocks...> chain(Blocks&... blocks)
+{
+    return Chain<Blocks...>(blocks...);
+}
+}
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Запись состояния блоков в двоичный буфер
+ *
+ * Значения записываются побайтно в порядке и представлении платформы,
+ * без выравнивания. Блоки записывают только изменяемое при работе состояние
+ * (интеграторы, прошлые входы, выходы, генераторы случайных чисел), но не
+ * настройки (коэффициенты, пределы), которые задаются при создании модели.
+ */
+class StateWriter
+{
+private:
+    std::vector<std::uint8_t>& bytes; //!< Буфер, в конец которого добавляются значения
+
+public:
+    explicit StateWriter(std::vector<std::uint8_t>& target)
+        : bytes{target}
+    {
+    }
+
+    /**
+     * @brief Записать значение тривиально копируемого типа
+     */
+    template <typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+        const std::size_t offset = bytes.size();
+        bytes.resize(offset + sizeof(T));
+        std::memcpy(bytes.data() + offset, &value, sizeof(T));
+    }
+
+    /**
+     * @brief Записать массив вместе с его размером
+     */
+    template <typename T>
+    void write(const T* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+        write(static_cast<std::uint64_t>(count));
+        const std::size_t offset = bytes.size();
+        bytes.resize(offset + count * sizeof(T));
+        if (count > 0)
+        {
+            std::memcpy(bytes.data() + offset, values, count * sizeof(T));
+        }
+    }
+
+    /**
+     * @brief Записать строку
+     */
+    void write(const std::string& text)
+    {
+        write(text.data(), text.size());
+    }
+};
+
+/**
+ * @brief Чтение состояния блоков из двоичного буфера, записанного StateWriter
+ *
+ * Выход за конец буфера и несовпадение размеров массивов (контрольная точка
+ * записана моделью другой конфигурации) приводят к std::invalid_argument.
+ */
+class StateReader
+{
+private:
+    const std::uint8_t* data; //!< Начало буфера
+    std::size_t size;         //!< Размер буфера
+    std::size_t offset = 0;   //!< Позиция следующего значения
+
+public:
+    StateReader(const std::uint8_t* bytes, std::size_t length)
+        : data{bytes}, size{length}
+    {
+    }
+
+    /**
+     * @brief Прочитать значение тривиально копируемого типа
+     */
+    template <typename T>
+    void read(T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    }
+
+    /**
+     * @brief Прочитать значение тривиально копируемого типа
+     */
+    template <typename T>
+    T read()
+    {
+        T value;
+        read(value);
+        return value;
+    }
+
+    /**
+     * @brief Прочитать массив из count значений
+     *
+     * Записанный размер массива должен совпадать с count.
+     */
+    template <typename T>
+    void read(T* values, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+        if (read<std::uint64_t>() != count)
+        {
+            throw std::invalid_argument("Checkpoint does not match the object layout");
+        }
+        if (count > 0)
+        {
+            std::memcpy(values, take(count * sizeof(T)), count * sizeof(T));
+        }
+    }
+
+    /**
+     * @brief Прочитать строку
+     */
+    void read(std::string& text)
+    {
+        const std::uint64_t length = read<std::uint64_t>();
+        const std::uint8_t* bytes = take(length);
+        text.assign(reinterpret_cast<const char*>(bytes), length);
+    }
+
+    /**
+     * @brief Количество непрочитанных байт
+     */
+    std::size_t remaining() const
+    {
+        return size - offset;
+    }
+
+private:
+    const std::uint8_t* take(std::size_t length)
+    {
+        if (length > size - offset)
+        {
+            throw std::invalid_argument("Checkpoint is truncated");
+        }
+        const std::uint8_t* result = data + offset;
+        offset += length;
+        return result;
+    }
+};
+
+namespace detail
+{
+/**
+ * @brief Признак наличия у объекта методов saveState/restoreState
+ */
+template <typename Object, typename = void>
+struct HasStateMethods : std::false_type
+{
+};
+
+template <typename Object>
+struct HasStateMethods<Object,
+    std::void_t<decltype(std::declval<const Object&>().saveState(std::declval<StateWriter&>())),
+                decltype(std::declval<Object&>().restoreState(std::declval<StateReader&>()))>>
+    : std::true_type
+{
+};
+
+/**
+ * @brief Записать состояние генератора случайных битов
+ *
+ * Philox4x32 записывает ключ и позицию (24 байта), стандартные генераторы -
+ * своё текстовое представление (operator<<), которое стандарт гарантирует
+ * восстанавливаемым.
+ */
+template <typename Engine>
+void saveEngine(StateWriter& out, const Engine& engine)
+{
+    if constexpr (HasStateMethods<Engine>::value)
+    {
+        engine.saveState(out);
+    }
+    else
+    {
+        std::ostringstream text;
+        text << engine;
+        out.write(text.str());
+    }
+}
+
+/**
+ * @brief Восстановить состояние генератора, записанное saveEngine
+ */
+template <typename Engine>
+void restoreEngine(StateReader& in, Engine& engine)
+{
+    if constexpr (HasStateMethods<Engine>::value)
+    {
+        engine.restoreState(in);
+    }
+    else
+    {
+        std::string state;
+        in.read(state);
+        std::istringstream text(state);
+        text >> engine;
+        if (!text)
+        {
+            throw std::invalid_argument("Checkpoint contains an invalid engine state");
+        }
+    }
+}
+
+/**
+ * @brief Хэш FNV-1a для проверки целостности контрольной точки
+ */
+inline std::uint64_t checkpointHash(const std::uint8_t* bytes, std::size_t length)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief Заголовок контрольной точки
+ */
+struct CheckpointHeader
+{
+    std::uint32_t magic;       //!< Сигнатура формата
+    std::uint16_t version;     //!< Версия формата
+    std::uint16_t byteOrder;   //!< Признак порядка байт платформы, записавшей точку
+    std::uint64_t payloadSize; //!< Размер данных после заголовка
+    std::uint64_t hash;        //!< Хэш данных после заголовка
+};
+}
+
+constexpr std::uint32_t checkpointMagic   = 0x50434253u; //!< Сигнатура контрольной точки ("SBCP")
+constexpr std::uint16_t checkpointVersion = 1;           //!< Версия формата контрольной точки
+
+/**
+ * @brief Записать контрольную точку состояния объектов в buffer
+ *
+ * Каждый объект (блок, регулятор, генератор Philox4x32) записывает своё
+ * состояние методом saveState под собственным мьютексом. Контрольная точка -
+ * заголовок (сигнатура, версия формата, порядок байт, размер, хэш) и состояния
+ * объектов в порядке аргументов. Буфер перезаписывается; при повторном
+ * использовании одного буфера память не выделяется.
+ *
+ * @param buffer Буфер для контрольной точки
+ * @param objects Объекты в том порядке, в котором они будут восстановлены
+ */
+template <typename... Objects>
+void saveCheckpoint(std::vector<std::uint8_t>& buffer, Objects&... objects)
+{
+    buffer.resize(sizeof(detail::CheckpointHeader));
+    StateWriter out(buffer);
+    (objects.saveState(out), ...);
+
+    detail::CheckpointHeader header{checkpointMagic, checkpointVersion, 0x0102u,
+                                    buffer.size() - sizeof(detail::CheckpointHeader), 0};
+    header.hash = detail::checkpointHash(buffer.data() + sizeof(header), header.payloadSize);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+}
+
+/**
+ * @brief Записать контрольную точку состояния объектов
+ *
+ * @return Контрольная точка
+ */
+template <typename... Objects>
+std::vector<std::uint8_t> saveCheckpoint(Objects&... objects)
+{
+    std::vector<std::uint8_t> buffer;
+    saveCheckpoint(buffer, objects...);
+    return buffer;
+}
+
+/**
+ * @brief Восстановить состояние объектов из контрольной точки
+ *
+ * Заголовок и хэш проверяются до изменения объектов. Объекты должны быть
+ * созданы с той же конфигурацией (размеры банков, порядок аргументов), что
+ * и при записи; несовпадение обнаруживается по размерам массивов и длине
+ * данных, но объекты, восстановленные до ошибки, остаются изменёнными.
+ *
+ * @param bytes Начало контрольной точки
+ * @param length Размер контрольной точки
+ * @param objects Объекты в порядке записи
+ */
+template <typename... Objects>
+void restoreCheckpoint(const std::uint8_t* bytes, std::size_t length, Objects&... objects)
+{
+    detail::CheckpointHeader header;
+    if (length < sizeof(header))
+    {
+        throw std::invalid_argument("Checkpoint is truncated");
+    }
+    std::memcpy(&header, bytes, sizeof(header));
+    if (header.magic != checkpointMagic)
+    {
+        throw std::invalid_argument("Data is not a checkpoint");
+    }
+    if (header.version != checkpointVersion || header.byteOrder != 0x0102u)
+    {
+        throw std::invalid_argument("Checkpoint was written by an incompatible version or platform");
+    }
+    if (header.payloadSize != length - sizeof(header))
+    {
+        throw std::invalid_argument("Checkpoint is truncated");
+    }
+    if (header.hash != detail::checkpointHash(bytes + sizeof(header), header.payloadSize))
+    {
+        throw std::invalid_argument("Checkpoint is corrupted");
+    }
+
+    StateReader in(bytes + sizeof(header), header.payloadSize);
+    (objects.restoreState(in), ...);
+    if (in.remaining() != 0)
+    {
+        throw std::invalid_argument("Checkpoint does not match the object layout");
+    }
+}
+
+/**
+ * @brief Восстановить состояние объектов из контрольной точки
+ */
+template <typename... Objects>
+void restoreCheckpoint(const std::vector<std::uint8_t>& checkpoint, Objects&... objects)
+{
+    restoreCheckpoint(checkpoint.data(), checkpoint.size(), objects...);
+}
+}
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Условие выполнения подсистемы
+ */
+enum class Activation
+{
+    Enabled, //!< Пока управляющий сигнал больше нуля
+    Rising,  //!< По переходу управляющего сигнала из значения <= 0 в значение > 0
+    Falling, //!< По переходу управляющего сигнала из значения > 0 в значение <= 0
+    Either   //!< По любому из переходов
+};
+
+/**
+ * @brief Выход выключенной подсистемы
+ */
+enum class InactiveOutput
+{
+    Held,  //!< Сохраняет последнее вычисленное значение
+    Reset  //!< Возвращается к начальному значению
+};
+
+/**
+ * @brief Состояния блоков подсистемы при её включении
+ */
+enum class EnableStates
+{
+    Held,  //!< Продолжают с сохранённых значений
+    Reset  //!< Сбрасываются методом reset() перед первым шагом
+};
+
+/**
+ * @brief Условно выполняемая подсистема (Enabled/Triggered Subsystem)
+ *
+ * В отличие от TriggeredSubsystem, которая только запоминает уже вычисленный
+ * вход, подсистема сама вызывает функцию body, выполняющую шаг содержащихся в
+ * ней блоков, и делает это только на шагах, когда выполнено условие
+ * активации. На остальных шагах блоки не выполняются и их состояния не
+ * меняются, поэтому неактивная ветвь модели (например, регулятор другого
+ * режима полёта) не требует вычислений.
+ *
+ * Функция body получает вход подсистемы и шаг времени: для Activation::Enabled
+ * это шаг текущего вызова, для срабатывания по фронту - время, прошедшее с
+ * предыдущего выполнения (или с начала моделирования), как у триггерных
+ * подсистем Simulink. Режимы InactiveOutput и EnableStates относятся к
+ * Activation::Enabled; подсистема, срабатывающая по фронту, всегда удерживает
+ * выход между срабатываниями.
+ *
+ * Функция body вызывается без захвата мьютекса подсистемы, поэтому может
+ * читать её getOutput() (предыдущий выход) и isActive(). Сброс состояний
+ * блоков выполняется до вызова body под мьютексом.
+ *
+ * Состояния блоков подсистемы в контрольную точку не входят, их записывают
+ * вместе с остальными блоками модели.
+ *
+ * @tparam T Тип входа и выхода
+ * @tparam U Тип управляющего сигнала
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, typename U = T, typename Mutex = std::mutex>
+class ConditionalSubsystem
+{
+public:
+    using Body = std::function<T(const T& input, const T& dt)>; //!< Шаг содержащихся блоков
+
+private:
+    Mutex mtx;                                //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Activation activation;                    //!< Условие выполнения
+    InactiveOutput inactiveOutput = InactiveOutput::Held; //!< Выход выключенной подсистемы
+    EnableStates enableStates = EnableStates::Held;       //!< Состояния блоков при включении
+    Body body;                                //!< Шаг содержащихся блоков
+    std::vector<std::function<void()>> resets; //!< Сброс состояний содержащихся блоков
+
+    T initialOutput;                          //!< Начальный выход
+    T output;                                 //!< Выход подсистемы
+    U previousControl = U(0);                 //!< Управляющий сигнал на предыдущем шаге
+    bool active = false;                      //!< Выполнялась ли подсистема на последнем шаге
+    T elapsed = T(0);                         //!< Время с предыдущего выполнения
+    unsigned long long executions = 0;        //!< Количество выполнений
+
+public:
+    /**
+     * @brief Конструктор подсистемы
+     *
+     * @param condition Условие выполнения
+     * @param function Шаг содержащихся блоков, возвращает выход подсистемы
+     * @param initial Начальный выход
+     */
+    ConditionalSubsystem(Activation condition, Body function, const T& initial = T{})
+        : activation{condition}, body{std::move(function)}, initialOutput{initial}, output{initial}
+    {
+        if (!body)
+        {
+            throw std::invalid_argument("Subsystem body should be set");
+        }
+    }
+
+    /**
+     * @brief Задать выход выключенной подсистемы
+     */
+    void setInactiveOutput(InactiveOutput mode)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        inactiveOutput = mode;
+    }
+
+    /**
+     * @brief Задать поведение состояний блоков при включении
+     */
+    void setEnableStates(EnableStates mode)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        enableStates = mode;
+    }
+
+    /**
+     * @brief Добавить блоки, принадлежащие подсистеме
+     *
+     * Их метод reset() вызывается при включении подсистемы в режиме
+     * EnableStates::Reset и при сбросе самой подсистемы.
+     *
+     * @param blocks Блоки, которые должны существовать, пока существует подсистема
+     */
+    template <typename... Blocks>
+    void addStates(Blocks&... blocks)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        (resets.push_back([&blocks] { blocks.reset(); }), ...);
+    }
+
+    /**
+     * @brief Выполнить один шаг подсистемы
+     *
+     * @param input Вход подсистемы
+     * @param control Управляющий сигнал (вход Enable или Trigger)
+     * @param dt Шаг времени
+     */
+    void step(const T& input, const U& control, const T& dt)
+    {
+        T bodyDt = dt;
+        {
+            std::lock_guard<Mutex> lock(mtx);
+            const bool wasPositive = previousControl > U(0);
+            const bool isPositive  = control > U(0);
+            previousControl = control;
+            elapsed += dt;
+
+            bool execute = false;
+            switch (activation)
+            {
+            case Activation::Enabled:
+                execute = isPositive;
+                break;
+            case Activation::Rising:
+                execute = !wasPositive && isPositive;
+                break;
+            case Activation::Falling:
+                execute = wasPositive && !isPositive;
+                break;
+            case Activation::Either:
+                execute = wasPositive != isPositive;
+                break;
+            }
+
+            if (!execute)
+            {
+                if (activation == Activation::Enabled && active && inactiveOutput == InactiveOutput::Reset)
+                {
+                    output = initialOutput;
+                }
+                active = false;
+                return;
+            }
+
+            if (activation == Activation::Enabled && !active && enableStates == EnableStates::Reset)
+            {
+                resetStates();
+            }
+            if (activation != Activation::Enabled)
+            {
+                bodyDt = elapsed;
+            }
+            elapsed = T(0);
+            active  = true;
+            ++executions;
+        }
+
+        const T result = body(input, bodyDt);
+        std::lock_guard<Mutex> lock(mtx);
+        output = result;
+    }
+
+    /**
+     * @brief Ссылка на выход подсистемы
+     */
+    const T& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Выполнялась ли подсистема на последнем шаге
+     */
+    bool isActive()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return active;
+    }
+
+    /**
+     * @brief Количество выполнений с момента создания или сброса
+     */
+    unsigned long long getExecutionCount()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return executions;
+    }
+
+    /**
+     * @brief Сбросить подсистему и состояния добавленных блоков
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        resetStates();
+        output          = initialOutput;
+        previousControl = U(0);
+        active          = false;
+        elapsed         = T(0);
+        executions      = 0;
+    }
+
+    /**
+     * @brief Записать состояние подсистемы в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+        out.write(previousControl);
+        out.write(active);
+        out.write(elapsed);
+        out.write(executions);
+    }
+
+    /**
+     * @brief Восстановить состояние подсистемы из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+        in.read(previousControl);
+        in.read(active);
+        in.read(elapsed);
+        in.read(executions);
+    }
+
+private:
+    void resetStates()
+    {
+        for (const auto& resetBlock : resets)
+        {
+            resetBlock();
+        }
+    }
+};
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
 #include <algorithm>
 #include <mutex>
 #include <stdexcept>
@@ -11,12 +14,13 @@ namespace SimulinkBlock
  * @brief Класс, реализующий блок дифференцирования
  *
  * @tparam T Тип прошлого состояния и входа для блока дифференцирования
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex>
 class DerivativeBlock
 {
 private:
-    std::mutex mtx;            //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx;                 //!< Мьютекс для блокировки одновременного доступа к переменным класса
     T prevInput;               //!< Состояние блока дифференцирования
     T derivativeOutput = T(0); //!< Выход блока дифференцирования
     T minLimit;                //!< Минимальный предел дифференцирования
@@ -48,7 +52,7 @@ public:
      */
     void setLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         if(min > max)
         {
             std::swap(maxLimit, minLimit);
@@ -66,12 +70,26 @@ public:
      * @param input Входное значение для дифференцирования
      * @param dt Временной шаг для дифференцирования
      */
-    void step(const T& input, double dt)
+    void step(const T& input, const T& dt)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        derivativeOutput = process(input, dt);
+    }
+
+    /**
+     * @brief Выполнить шаг дифференцирования без блокировки мьютекса и без записи выхода блока
+     *
+     * Используется при слиянии блоков в цепочку (chain).
+     *
+     * @param input Входное значение для дифференцирования
+     * @param dt Временной шаг для дифференцирования
+     * @return Ограниченная производная
+     */
+    T process(const T& input, const T& dt)
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        derivativeOutput = (input - prevInput) / dt;
-        derivativeOutput = std::clamp(derivativeOutput, minLimit, maxLimit);
+        T derivative = (input - prevInput) / dt;
         prevInput = input;
+        return std::clamp(derivative, minLimit, maxLimit);
     }
 
     /**
@@ -81,7 +99,7 @@ public:
      */
     void setState(const T& newPrevInput)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         prevInput = newPrevInput;
     }
 
@@ -92,7 +110,7 @@ public:
      */
     const T& getState()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return prevInput;
     }
 
@@ -103,7 +121,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return derivativeOutput;
     }
 
@@ -112,9 +130,29 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         prevInput        = T(0);
         derivativeOutput = T(0);
     }
+
+    /**
+     * @brief Записать состояние блока дифференцирования в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(prevInput);
+        out.write(derivativeOutput);
+    }
+
+    /**
+     * @brief Восстановить состояние блока дифференцирования из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(prevInput);
+        in.read(derivativeOutput);
+    }
 };
 }
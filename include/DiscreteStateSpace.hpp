@@ -0,0 +1,418 @@
+#pragma once
+
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Матрица фиксированного размера, хранящаяся по строкам
+ */
+template <typename T, std::size_t Rows, std::size_t Cols>
+using Matrix = std::array<std::array<T, Cols>, Rows>;
+
+namespace detail
+{
+/**
+ * @brief result += m * v для матрицы и вектора фиксированного размера
+ *
+ * Границы циклов известны при компиляции, поэтому для малых размерностей
+ * компилятор полностью разворачивает циклы и держит векторы в регистрах.
+ */
+template <typename T, std::size_t Rows, std::size_t Cols>
+void multiplyAdd(const Matrix<T, Rows, Cols>& m, const std::array<T, Cols>& v, std::array<T, Rows>& result)
+{
+    for (std::size_t i = 0; i < Rows; ++i)
+    {
+        for (std::size_t j = 0; j < Cols; ++j)
+        {
+            result[i] += m[i][j] * v[j];
+        }
+    }
+}
+
+/**
+ * @brief target[lane] += sum_j row[j] * source[j * lanes + lane] для всех каналов
+ *
+ * Внутренний цикл проходит по непрерывному массиву каналов без ветвлений и
+ * зависимостей между итерациями, поэтому компилятор сводит его к векторным
+ * умножениям и сложениям. Порядок сложения для каждого канала совпадает с
+ * multiplyAdd.
+ */
+template <typename T>
+void accumulateLanes(const T* row, std::size_t columns,
+                     const T* __restrict source,
+                     T* __restrict target,
+                     std::size_t lanes)
+{
+    for (std::size_t j = 0; j < columns; ++j)
+    {
+        const T coefficient = row[j];
+        const T* column = source + j * lanes;
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            target[lane] += coefficient * column[lane];
+        }
+    }
+}
+}
+
+/**
+ * @brief Класс, реализующий логику работы блока Discrete State-Space
+ *
+ * y[k] = C x[k] + D u[k], x[k+1] = A x[k] + B u[k]. Размерности задаются при
+ * компиляции, матрицы и векторы хранятся в выровненных массивах фиксированного
+ * размера без выделения памяти, а умножения разворачиваются компилятором.
+ * Заменяет цепочки IntegratorBlock и коэффициентов с отдельной блокировкой
+ * на каждый блок одним блоком с одной блокировкой на шаг.
+ *
+ * @tparam T Тип входа, выхода и состояния
+ * @tparam Nx Количество состояний
+ * @tparam Nu Количество входов
+ * @tparam Ny Количество выходов
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, std::size_t Nx, std::size_t Nu, std::size_t Ny, typename Mutex = std::mutex>
+class DiscreteStateSpace
+{
+    static_assert(Nx > 0 && Nu > 0 && Ny > 0, "State-space dimensions should be positive");
+
+public:
+    using StateVector  = std::array<T, Nx>; //!< Вектор состояния
+    using InputVector  = std::array<T, Nu>; //!< Вектор входов
+    using OutputVector = std::array<T, Ny>; //!< Вектор выходов
+
+private:
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+
+    alignas(64) Matrix<T, Nx, Nx> a; //!< Матрица состояния
+    alignas(64) Matrix<T, Nx, Nu> b; //!< Матрица входа
+    alignas(64) Matrix<T, Ny, Nx> c; //!< Матрица выхода
+    alignas(64) Matrix<T, Ny, Nu> d; //!< Матрица прямой связи
+
+    alignas(64) StateVector state{};   //!< Текущее состояние
+    alignas(64) OutputVector output{}; //!< Выход блока
+
+public:
+    /**
+     * @brief Конструктор блока
+     *
+     * @param stateMatrix Матрица A
+     * @param inputMatrix Матрица B
+     * @param outputMatrix Матрица C
+     * @param feedthroughMatrix Матрица D
+     * @param initialState Начальное состояние
+     */
+    DiscreteStateSpace(const Matrix<T, Nx, Nx>& stateMatrix,
+                       const Matrix<T, Nx, Nu>& inputMatrix,
+                       const Matrix<T, Ny, Nx>& outputMatrix,
+                       const Matrix<T, Ny, Nu>& feedthroughMatrix = {},
+                       const StateVector& initialState = {})
+        : a{stateMatrix}, b{inputMatrix}, c{outputMatrix}, d{feedthroughMatrix}, state{initialState}
+    {
+    }
+
+    /**
+     * @brief Выполнить один шаг блока
+     *
+     * @param input Входы блока
+     */
+    void step(const InputVector& input)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = process(input);
+    }
+
+    /**
+     * @brief Выполнить один шаг без блокировки мьютекса и без записи выхода блока
+     *
+     * Используется при слиянии блоков в цепочку (chain).
+     *
+     * @param input Входы блока
+     * @return Выходы блока на этом шаге
+     */
+    OutputVector process(const InputVector& input)
+    {
+        OutputVector y{};
+        detail::multiplyAdd(c, state, y);
+        detail::multiplyAdd(d, input, y);
+
+        StateVector next{};
+        detail::multiplyAdd(a, state, next);
+        detail::multiplyAdd(b, input, next);
+        state = next;
+        return y;
+    }
+
+    /**
+     * @brief Ссылка на выходы блока
+     */
+    const OutputVector& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Ссылка на текущее состояние
+     */
+    const StateVector& getState()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return state;
+    }
+
+    /**
+     * @brief Установить состояние
+     *
+     * @param newState Новое значение состояния для установки
+     */
+    void setState(const StateVector& newState)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        state = newState;
+    }
+
+    /**
+     * @brief Обнулить состояние и выход блока
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        state.fill(T(0));
+        output.fill(T(0));
+    }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state);
+        in.read(output);
+    }
+};
+
+/**
+ * @brief Банк независимых систем Discrete State-Space с общими матрицами
+ *
+ * Каждый канал ведёт себя так же, как DiscreteStateSpace с теми же матрицами.
+ * Состояния, входы и выходы хранятся в виде структуры массивов: компонента
+ * j канала lane лежит по индексу j * size() + lane, поэтому один коэффициент
+ * матрицы умножается сразу на вектор каналов. Результат каждого канала
+ * совпадает с DiscreteStateSpace с точностью до округления: при сборке с
+ * FMA (-march=native) развёрнутый и векторный циклы могут по-разному сливать
+ * умножения и сложения.
+ *
+ * @tparam T Тип входа, выхода и состояния
+ * @tparam Nx Количество состояний
+ * @tparam Nu Количество входов
+ * @tparam Ny Количество выходов
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, std::size_t Nx, std::size_t Nu, std::size_t Ny, typename Mutex = std::mutex>
+class DiscreteStateSpaceBank
+{
+    static_assert(Nx > 0 && Nu > 0 && Ny > 0, "State-space dimensions should be positive");
+
+public:
+    using StateVector = std::array<T, Nx>; //!< Вектор состояния одного канала
+
+private:
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+
+    alignas(64) Matrix<T, Nx, Nx> a; //!< Матрица состояния
+    alignas(64) Matrix<T, Nx, Nu> b; //!< Матрица входа
+    alignas(64) Matrix<T, Ny, Nx> c; //!< Матрица выхода
+    alignas(64) Matrix<T, Ny, Nu> d; //!< Матрица прямой связи
+
+    std::size_t lanes;       //!< Количество каналов
+    std::vector<T> state;    //!< Состояния каналов, Nx строк по lanes значений
+    std::vector<T> next;     //!< Состояния на следующем шаге
+    std::vector<T> output;   //!< Выходы каналов, Ny строк по lanes значений
+
+public:
+    /**
+     * @brief Конструктор банка
+     *
+     * @param channels Количество систем
+     * @param stateMatrix Матрица A
+     * @param inputMatrix Матрица B
+     * @param outputMatrix Матрица C
+     * @param feedthroughMatrix Матрица D
+     */
+    DiscreteStateSpaceBank(std::size_t channels,
+                           const Matrix<T, Nx, Nx>& stateMatrix,
+                           const Matrix<T, Nx, Nu>& inputMatrix,
+                           const Matrix<T, Ny, Nx>& outputMatrix,
+                           const Matrix<T, Ny, Nu>& feedthroughMatrix = {})
+        : a{stateMatrix}, b{inputMatrix}, c{outputMatrix}, d{feedthroughMatrix},
+          lanes{channels},
+          state(Nx * channels, T(0)),
+          next(Nx * channels, T(0)),
+          output(Ny * channels, T(0))
+    {
+    }
+
+    /**
+     * @brief Количество систем в банке
+     */
+    std::size_t size() const
+    {
+        return lanes;
+    }
+
+    /**
+     * @brief Выполнить один шаг всех систем
+     *
+     * @param inputs Указатель на Nu * size() входов: вход k канала lane по индексу k * size() + lane
+     */
+    void step(const T* inputs)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        std::fill(output.begin(), output.end(), T(0));
+        std::fill(next.begin(), next.end(), T(0));
+
+        for (std::size_t i = 0; i < Ny; ++i)
+        {
+            T* y = output.data() + i * lanes;
+            detail::accumulateLanes(c[i].data(), Nx, state.data(), y, lanes);
+            detail::accumulateLanes(d[i].data(), Nu, inputs, y, lanes);
+        }
+        for (std::size_t i = 0; i < Nx; ++i)
+        {
+            T* x = next.data() + i * lanes;
+            detail::accumulateLanes(a[i].data(), Nx, state.data(), x, lanes);
+            detail::accumulateLanes(b[i].data(), Nu, inputs, x, lanes);
+        }
+        state.swap(next);
+    }
+
+    /**
+     * @brief Выполнить один шаг всех систем
+     *
+     * @param inputs Входы в порядке step(const T*), размер должен быть Nu * size()
+     */
+    void step(const std::vector<T>& inputs)
+    {
+        if (inputs.size() != Nu * lanes)
+        {
+            throw std::invalid_argument("Inputs size should match the number of inputs times channels");
+        }
+        step(inputs.data());
+    }
+
+    /**
+     * @brief Выход с номером row одной системы
+     *
+     * @param channel Номер системы
+     * @param row Номер выхода
+     */
+    const T& getOutput(std::size_t channel, std::size_t row = 0)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if (channel >= lanes || row >= Ny)
+        {
+            throw std::out_of_range("Channel or output index is out of range");
+        }
+        return output[row * lanes + channel];
+    }
+
+    /**
+     * @brief Ссылка на выходы всех систем: выход i канала lane по индексу i * size() + lane
+     */
+    const std::vector<T>& getOutputs()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Состояние одной системы
+     *
+     * @param channel Номер системы
+     */
+    StateVector getState(std::size_t channel)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if (channel >= lanes)
+        {
+            throw std::out_of_range("Channel index is out of range");
+        }
+        StateVector result;
+        for (std::size_t j = 0; j < Nx; ++j)
+        {
+            result[j] = state[j * lanes + channel];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Установить состояние одной системы
+     *
+     * @param channel Номер системы
+     * @param newState Новое значение состояния для установки
+     */
+    void setState(std::size_t channel, const StateVector& newState)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if (channel >= lanes)
+        {
+            throw std::out_of_range("Channel index is out of range");
+        }
+        for (std::size_t j = 0; j < Nx; ++j)
+        {
+            state[j * lanes + channel] = newState[j];
+        }
+    }
+
+    /**
+     * @brief Обнулить состояния и выходы всех систем
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        std::fill(state.begin(), state.end(), T(0));
+        std::fill(output.begin(), output.end(), T(0));
+    }
+
+    /**
+     * @brief Записать состояние всех систем в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state.data(), state.size());
+        out.write(output.data(), output.size());
+    }
+
+    /**
+     * @brief Восстановить состояние всех систем из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state.data(), state.size());
+        in.read(output.data(), output.size());
+    }
+};
+}
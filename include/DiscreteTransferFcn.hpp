@@ -0,0 +1,327 @@
+#pragma once
+
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+namespace detail
+{
+/**
+ * @brief Привести коэффициенты передаточной функции к a0 = 1
+ */
+template <typename T, std::size_t N>
+void normalizeTransferFcn(std::array<T, N>& numerator, std::array<T, N>& denominator)
+{
+    const T leading = denominator[0];
+    if (leading == T(0))
+    {
+        throw std::invalid_argument("Leading denominator coefficient should not be zero");
+    }
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        numerator[i]   = numerator[i] / leading;
+        denominator[i] = denominator[i] / leading;
+    }
+}
+}
+
+/**
+ * @brief Класс, реализующий логику работы блока Discrete Transfer Fcn
+ *
+ * H(z) = (b0 z^n + b1 z^(n-1) + ... + bn) / (a0 z^n + a1 z^(n-1) + ... + an),
+ * коэффициенты задаются по убывающим степеням z; числитель меньшей степени
+ * дополняется нулями слева (b0 = 0 - блок без прямой связи). Шаг выполняется
+ * по транспонированной второй прямой форме: n состояний в выровненном массиве
+ * фиксированного размера и 2n + 1 умножений без выделения памяти.
+ *
+ * @tparam T Тип входа, выхода и состояния
+ * @tparam Order Порядок знаменателя n
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, std::size_t Order, typename Mutex = std::mutex>
+class DiscreteTransferFcn
+{
+    static_assert(Order > 0, "Transfer function order should be positive");
+
+public:
+    using Coefficients = std::array<T, Order + 1>; //!< Коэффициенты многочлена
+
+private:
+    Mutex mtx;       //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    T output = T(0); //!< Выход блока
+
+    alignas(64) Coefficients num;           //!< Коэффициенты числителя при a0 = 1
+    alignas(64) Coefficients den;           //!< Коэффициенты знаменателя при a0 = 1
+    alignas(64) std::array<T, Order> state{}; //!< Состояния транспонированной второй прямой формы
+
+public:
+    /**
+     * @brief Конструктор блока
+     *
+     * @param numerator Коэффициенты числителя
+     * @param denominator Коэффициенты знаменателя, denominator[0] не равен нулю
+     */
+    DiscreteTransferFcn(const Coefficients& numerator, const Coefficients& denominator)
+        : num{numerator}, den{denominator}
+    {
+        detail::normalizeTransferFcn(num, den);
+    }
+
+    /**
+     * @brief Выполнить один шаг блока
+     *
+     * @param input Входное значение
+     */
+    void step(const T& input)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = process(input);
+    }
+
+    /**
+     * @brief Выполнить один шаг без блокировки мьютекса и без записи выхода блока
+     *
+     * Используется при слиянии блоков в цепочку (chain).
+     *
+     * @param input Входное значение
+     * @return Выход блока на этом шаге
+     */
+    T process(const T& input)
+    {
+        const T y = num[0] * input + state[0];
+        for (std::size_t i = 0; i + 1 < Order; ++i)
+        {
+            state[i] = state[i + 1] + num[i + 1] * input - den[i + 1] * y;
+        }
+        state[Order - 1] = num[Order] * input - den[Order] * y;
+        return y;
+    }
+
+    /**
+     * @brief Установить новые коэффициенты, сохранив состояние
+     *
+     * @param numerator Коэффициенты числителя
+     * @param denominator Коэффициенты знаменателя, denominator[0] не равен нулю
+     */
+    void setCoefficients(const Coefficients& numerator, const Coefficients& denominator)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        Coefficients newNum = numerator;
+        Coefficients newDen = denominator;
+        detail::normalizeTransferFcn(newNum, newDen);
+        num = newNum;
+        den = newDen;
+    }
+
+    /**
+     * @brief Ссылка на выход блока
+     */
+    const T& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить состояния и выход блока
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        state.fill(T(0));
+        output = T(0);
+    }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state);
+        in.read(output);
+    }
+};
+
+/**
+ * @brief Банк независимых блоков Discrete Transfer Fcn с общими коэффициентами
+ *
+ * Каждый канал ведёт себя так же, как DiscreteTransferFcn, с точностью до
+ * округления: при сборке с FMA (-march=native) компилятор может по-разному
+ * сливать умножения и сложения в развёрнутом и векторном циклах. Состояния
+ * хранятся в виде структуры массивов (состояние i канала lane по индексу
+ * i * size() + lane), и каждый шаг транспонированной второй прямой формы
+ * выполняется одним векторизуемым проходом по каналам.
+ *
+ * @tparam T Тип входа, выхода и состояния
+ * @tparam Order Порядок знаменателя
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, std::size_t Order, typename Mutex = std::mutex>
+class DiscreteTransferFcnBank
+{
+    static_assert(Order > 0, "Transfer function order should be positive");
+
+public:
+    using Coefficients = std::array<T, Order + 1>; //!< Коэффициенты многочлена
+
+private:
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+
+    alignas(64) Coefficients num; //!< Коэффициенты числителя при a0 = 1
+    alignas(64) Coefficients den; //!< Коэффициенты знаменателя при a0 = 1
+
+    std::size_t lanes;      //!< Количество каналов
+    std::vector<T> state;   //!< Состояния каналов, Order строк по lanes значений
+    std::vector<T> output;  //!< Выходы каналов
+
+public:
+    /**
+     * @brief Конструктор банка
+     *
+     * @param channels Количество блоков
+     * @param numerator Коэффициенты числителя
+     * @param denominator Коэффициенты знаменателя, denominator[0] не равен нулю
+     */
+    DiscreteTransferFcnBank(std::size_t channels, const Coefficients& numerator, const Coefficients& denominator)
+        : num{numerator}, den{denominator},
+          lanes{channels},
+          state(Order * channels, T(0)),
+          output(channels, T(0))
+    {
+        detail::normalizeTransferFcn(num, den);
+    }
+
+    /**
+     * @brief Количество блоков в банке
+     */
+    std::size_t size() const
+    {
+        return lanes;
+    }
+
+    /**
+     * @brief Выполнить один шаг всех блоков
+     *
+     * @param inputs Указатель на size() входных значений
+     */
+    void step(const T* __restrict inputs)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        T* __restrict y = output.data();
+        {
+            // z0 только читается и выходит из области видимости до записи состояний через z
+            const T* __restrict z0 = state.data();
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                y[lane] = num[0] * inputs[lane] + z0[lane];
+            }
+        }
+
+        for (std::size_t i = 0; i < Order; ++i)
+        {
+            T* __restrict z = state.data() + i * lanes;
+            const T b = num[i + 1];
+            const T a = den[i + 1];
+            if (i + 1 < Order)
+            {
+                const T* __restrict zNext = z + lanes;
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    z[lane] = zNext[lane] + b * inputs[lane] - a * y[lane];
+                }
+            }
+            else
+            {
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    z[lane] = b * inputs[lane] - a * y[lane];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Выполнить один шаг всех блоков
+     *
+     * @param inputs Входные значения, размер должен совпадать с size()
+     */
+    void step(const std::vector<T>& inputs)
+    {
+        if (inputs.size() != lanes)
+        {
+            throw std::invalid_argument("Inputs size should match the number of channels");
+        }
+        step(inputs.data());
+    }
+
+    /**
+     * @brief Ссылка на выход одного блока
+     *
+     * @param channel Номер блока
+     */
+    const T& getOutput(std::size_t channel)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output.at(channel);
+    }
+
+    /**
+     * @brief Ссылка на выходы всех блоков
+     */
+    const std::vector<T>& getOutputs()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить состояния и выходы всех блоков
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        std::fill(state.begin(), state.end(), T(0));
+        std::fill(output.begin(), output.end(), T(0));
+    }
+
+    /**
+     * @brief Записать состояние всех блоков в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state.data(), state.size());
+        out.write(output.data(), output.size());
+    }
+
+    /**
+     * @brief Восстановить состояние всех блоков из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state.data(), state.size());
+        in.read(output.data(), output.size());
+    }
+};
+}
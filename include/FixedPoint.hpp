@@ -0,0 +1,255 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Знаковое число с фиксированной точкой и насыщением
+ *
+ * Значение хранится целым числом raw шириной IntBits + FracBits бит
+ * (знаковый бит входит в IntBits) и равно raw * 2^-FracBits, например
+ * Fixed<16, 16> - формат Q15.16 в int32_t с диапазоном [-32768, 32768).
+ * Все операции выполняются целочисленно в 64-битном промежуточном типе и
+ * насыщаются на границах диапазона, поэтому тип подходит для процессоров
+ * без FPU и может быть параметром T блоков IntegratorBlock, SaturationBlock,
+ * RateLimiter, DerivativeBlock, PID и LookupTable1D.
+ *
+ * Округление: умножение и преобразование из числа с плавающей точкой - к
+ * ближайшему, деление - к нулю. Деление на ноль насыщается по знаку делимого.
+ * Преобразования из арифметических типов и в них явные, чтобы вычисления
+ * в double не смешивались с целочисленными незаметно.
+ *
+ * @tparam IntBits Количество бит целой части вместе со знаком
+ * @tparam FracBits Количество бит дробной части
+ */
+template <int IntBits, int FracBits>
+class Fixed
+{
+    static_assert(IntBits >= 1, "Fixed-point type should have a sign bit");
+    static_assert(FracBits >= 0, "Number of fractional bits should not be negative");
+    static_assert(IntBits + FracBits <= 32, "Fixed-point type should fit into 32 bits");
+
+public:
+    static constexpr int width = IntBits + FracBits; //!< Ширина значения в битах
+
+    using Raw  = std::conditional_t<(width <= 8), std::int8_t,
+                 std::conditional_t<(width <= 16), std::int16_t, std::int32_t>>; //!< Тип хранения
+    using Wide = std::int64_t;                                                 //!< Промежуточный тип операций
+
+    static constexpr Wide one    = Wide(1) << FracBits;          //!< Представление единицы
+    static constexpr Wide maxRaw = (Wide(1) << (width - 1)) - 1; //!< Наибольшее представление
+    static constexpr Wide minRaw = -(Wide(1) << (width - 1));    //!< Наименьшее представление
+
+private:
+    Raw value = 0; //!< Представление числа
+
+public:
+    constexpr Fixed() = default;
+
+    /**
+     * @brief Преобразование из арифметического типа с округлением к ближайшему и насыщением
+     *
+     * NaN преобразуется в ноль.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    constexpr explicit Fixed(U number)
+        : value{convert(number)}
+    {
+    }
+
+    /**
+     * @brief Число с заданным представлением
+     */
+    static constexpr Fixed fromRaw(Wide raw)
+    {
+        Fixed result;
+        result.value = saturate(raw);
+        return result;
+    }
+
+    /**
+     * @brief Представление числа
+     */
+    constexpr Raw raw() const
+    {
+        return value;
+    }
+
+    /**
+     * @brief Преобразование в арифметический тип
+     *
+     * Для целых типов дробная часть отбрасывается (округление к нулю).
+     */
+    template <typename U, typename = std::enable_if_t<std::is_arithmetic_v<U>>>
+    constexpr explicit operator U() const
+    {
+        if constexpr (std::is_floating_point_v<U>)
+        {
+            return static_cast<U>(value) / static_cast<U>(one);
+        }
+        else
+        {
+            return static_cast<U>(Wide(value) / one);
+        }
+    }
+
+    constexpr Fixed operator-() const
+    {
+        return fromRaw(-Wide(value));
+    }
+
+    constexpr Fixed operator+() const
+    {
+        return *this;
+    }
+
+    friend constexpr Fixed operator+(Fixed a, Fixed b)
+    {
+        return fromRaw(Wide(a.value) + Wide(b.value));
+    }
+
+    friend constexpr Fixed operator-(Fixed a, Fixed b)
+    {
+        return fromRaw(Wide(a.value) - Wide(b.value));
+    }
+
+    friend constexpr Fixed operator*(Fixed a, Fixed b)
+    {
+        Wide product = Wide(a.value) * Wide(b.value);
+        if constexpr (FracBits > 0)
+        {
+            product = (product + (Wide(1) << (FracBits - 1))) >> FracBits;
+        }
+        return fromRaw(product);
+    }
+
+    friend constexpr Fixed operator/(Fixed a, Fixed b)
+    {
+        if (b.value == 0)
+        {
+            return fromRaw(a.value > 0 ? maxRaw : (a.value < 0 ? minRaw : 0));
+        }
+        return fromRaw(Wide(a.value) * one / Wide(b.value));
+    }
+
+    constexpr Fixed& operator+=(Fixed other)
+    {
+        return *this = *this + other;
+    }
+
+    constexpr Fixed& operator-=(Fixed other)
+    {
+        return *this = *this - other;
+    }
+
+    constexpr Fixed& operator*=(Fixed other)
+    {
+        return *this = *this * other;
+    }
+
+    constexpr Fixed& operator/=(Fixed other)
+    {
+        return *this = *this / other;
+    }
+
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.value == b.value; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.value != b.value; }
+    friend constexpr bool operator<(Fixed a, Fixed b)  { return a.value < b.value; }
+    friend constexpr bool operator>(Fixed a, Fixed b)  { return a.value > b.value; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.value <= b.value; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.value >= b.value; }
+
+private:
+    /**
+     * @brief Ограничить представление диапазоном типа
+     */
+    static constexpr Raw saturate(Wide raw)
+    {
+        return static_cast<Raw>(raw > maxRaw ? maxRaw : (raw < minRaw ? minRaw : raw));
+    }
+
+    /**
+     * @brief Представление арифметического значения
+     */
+    template <typename U>
+    static constexpr Raw convert(U number)
+    {
+        if constexpr (std::is_floating_point_v<U>)
+        {
+            const long double scaled = static_cast<long double>(number) * static_cast<long double>(one);
+            if (!(scaled == scaled))
+            {
+                return 0;
+            }
+            if (scaled >= static_cast<long double>(maxRaw))
+            {
+                return static_cast<Raw>(maxRaw);
+            }
+            if (scaled <= static_cast<long double>(minRaw))
+            {
+                return static_cast<Raw>(minRaw);
+            }
+            return saturate(static_cast<Wide>(scaled + (scaled < 0 ? -0.5L : 0.5L)));
+        }
+        else if constexpr (std::is_signed_v<U>)
+        {
+            const Wide integer = static_cast<Wide>(number);
+            if (integer > (maxRaw >> FracBits))
+            {
+                return static_cast<Raw>(maxRaw);
+            }
+            if (integer < (minRaw >> FracBits))
+            {
+                return static_cast<Raw>(minRaw);
+            }
+            return saturate(integer * one);
+        }
+        else
+        {
+            if (number > static_cast<U>(maxRaw >> FracBits))
+            {
+                return static_cast<Raw>(maxRaw);
+            }
+            return saturate(static_cast<Wide>(number) * one);
+        }
+    }
+};
+}
+
+namespace std
+{
+/**
+ * @brief Характеристики типа Fixed
+ *
+ * min() - наименьшее положительное значение (как у типов с плавающей
+ * точкой), lowest() - наименьшее значение, epsilon() - шаг представления.
+ */
+template <int IntBits, int FracBits>
+class numeric_limits<SimulinkBlock::Fixed<IntBits, FracBits>>
+{
+private:
+    using Type = SimulinkBlock::Fixed<IntBits, FracBits>;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed      = true;
+    static constexpr bool is_integer     = false;
+    static constexpr bool is_exact       = true;
+    static constexpr bool has_infinity   = false;
+    static constexpr bool has_quiet_NaN  = false;
+    static constexpr bool is_bounded     = true;
+    static constexpr bool is_modulo      = false;
+    static constexpr int  radix          = 2;
+    static constexpr int  digits         = IntBits + FracBits - 1;
+
+    static constexpr Type min() noexcept         { return Type::fromRaw(1); }
+    static constexpr Type max() noexcept         { return Type::fromRaw(Type::maxRaw); }
+    static constexpr Type lowest() noexcept      { return Type::fromRaw(Type::minRaw); }
+    static constexpr Type epsilon() noexcept     { return Type::fromRaw(1); }
+    static constexpr Type round_error() noexcept { return Type(0.5); }
+};
+}
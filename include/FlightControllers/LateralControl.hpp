@@ -2,18 +2,20 @@
 
 #include "../IntegratorBlock.hpp"
 #include "../SaturationBlock.hpp"
+#include "../ThreadingPolicy.hpp"
 #include <iostream>
 
 namespace SimulinkBlock
 {
 /**
  * @brief Класс для реализации бокового канала управления с одним методом step
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex>
 class LateralControl
 {
 private:
-    std::mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
 
     std::pair<T, T> output; //!< Результат расчёта отклонение элеронов и руля направления
 
@@ -24,8 +26,8 @@ private:
     bool rudderControlEnabled = true;
 
     // Канал элеронов
-    IntegratorBlock<T> integrator_roll_aileron;
-    IntegratorBlock<T> integrator_yaw_aileron;
+    IntegratorBlock<T, NullMutex> integrator_roll_aileron;
+    IntegratorBlock<T, NullMutex> integrator_yaw_aileron;
 
     T K_omega_roll_aileron;
     T K_psi_aileron;
@@ -33,9 +35,9 @@ private:
     T K_roll_aileron;
     T K_i_roll_aileron;
 
-    SaturationBlock<T> desiredRollSaturation; //!< Ограничения желаемого угла крена
-    SaturationBlock<T> aileronSaturation;     //!< Ограничения на отклонения элеронов
-    SaturationBlock<T> rudderSaturation;      //!< Ограничения на отклонения руля направления
+    SaturationBlock<T, NullMutex> desiredRollSaturation; //!< Ограничения желаемого угла крена
+    SaturationBlock<T, NullMutex> aileronSaturation;     //!< Ограничения на отклонения элеронов
+    SaturationBlock<T, NullMutex> rudderSaturation;      //!< Ограничения на отклонения руля направления
 
     bool yawAngleControlEnabled       = true; //!<
     bool rollAngleControlEnabled      = true; //!< Флаг для включения/выключения контура угла крена
@@ -54,7 +56,7 @@ public:
      */
     void setRudderControllCoeffs(const T& K_omega_yaw_rudder, const T& K_roll_rudder)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
 
         this->K_roll_rudder      = K_roll_rudder;
         this->K_omega_yaw_rudder = K_omega_yaw_rudder;
@@ -69,7 +71,7 @@ public:
                                   const T& K_psi_aileron,
                                   const T& K_psi_i_aileron)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
 
         this->K_omega_roll_aileron = K_omega_roll_aileron;
         this->K_roll_aileron       = K_roll_aileron;
@@ -83,7 +85,7 @@ public:
      */
     void setRollSaturationLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         desiredRollSaturation.setLimits(min, max);
     }
 
@@ -92,7 +94,7 @@ public:
      */
     void setRudderSaturationLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         rudderSaturation.setLimits(min, max);
     }
 
@@ -101,7 +103,7 @@ public:
      */
     void setAileronsSaturationLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         aileronSaturation.setLimits(min, max);
     }
 
@@ -110,7 +112,7 @@ public:
      */
     void enableRudderControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         rudderControlEnabled = enable;
     }
 
@@ -119,7 +121,7 @@ public:
      */
     void enableYawAngleControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         yawAngleControlEnabled = enable;
     }
 
@@ -128,7 +130,7 @@ public:
      */
     void enableRollAngleControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         rollAngleControlEnabled = enable;
     }
 
@@ -137,7 +139,7 @@ public:
      */
     void enableAngularVelocityRollControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         angularVelocityRollEnabled = enable;
     }
 
@@ -158,7 +160,7 @@ public:
         const T& currentRollAngularVelocity,
         double dt)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
 
         T inputForRollAngle = desiredYawAngle; // Вход для контура угла крена
         T inputForAngularVelocity = inputForRollAngle; // Вход для контура угловой скорости крена
@@ -217,7 +219,7 @@ public:
      */
     const std::pair<T, T>& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -226,7 +228,7 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
 
         output = std::pair<T, T>{0};
 
@@ -242,5 +244,43 @@ public:
         K_roll_aileron = T{0};
         K_i_roll_aileron = T{0};
     }
+
+    /**
+     * @brief Записать состояние регулятора (выходы, интеграторы, включённые контуры) в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output.first);
+        out.write(output.second);
+        integrator_roll_aileron.saveState(out);
+        integrator_yaw_aileron.saveState(out);
+        desiredRollSaturation.saveState(out);
+        aileronSaturation.saveState(out);
+        rudderSaturation.saveState(out);
+        out.write(rudderControlEnabled);
+        out.write(yawAngleControlEnabled);
+        out.write(rollAngleControlEnabled);
+        out.write(angularVelocityRollEnabled);
+    }
+
+    /**
+     * @brief Восстановить состояние регулятора (выходы, интеграторы, включённые контуры) из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output.first);
+        in.read(output.second);
+        integrator_roll_aileron.restoreState(in);
+        integrator_yaw_aileron.restoreState(in);
+        desiredRollSaturation.restoreState(in);
+        aileronSaturation.restoreState(in);
+        rudderSaturation.restoreState(in);
+        in.read(rudderControlEnabled);
+        in.read(yawAngleControlEnabled);
+        in.read(rollAngleControlEnabled);
+        in.read(angularVelocityRollEnabled);
+    }
 };
 }
@@ -2,27 +2,29 @@
 
 #include "../PID.hpp"
 #include "../SaturationBlock.hpp"
+#include "../ThreadingPolicy.hpp"
 
 namespace SimulinkBlock
 {
 /**
  * @brief Класс для реализации контура тангажа с одним методом step
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex>
 class LongitudalControl
 {
 private:
-    std::mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
 
     std::pair<T, T> output; //!< Результат рассчёта
 
-    PID<T> velocityPid;        //!< ПИД-регулятор для контура скорости
-    PID<T> altitudePid;        //!< ПИД-регулятор для контура высоты
-    PID<T> pitchAnglePid;      //!< ПИД-регулятор для контура угла тангажа
-    PID<T> angularVelocityPid; //!< ПИД-регулятор для контура угловой скорости
+    PID<T, NullMutex> velocityPid;        //!< ПИД-регулятор для контура скорости
+    PID<T, NullMutex> altitudePid;        //!< ПИД-регулятор для контура высоты
+    PID<T, NullMutex> pitchAnglePid;      //!< ПИД-регулятор для контура угла тангажа
+    PID<T, NullMutex> angularVelocityPid; //!< ПИД-регулятор для контура угловой скорости
 
 
-    SaturationBlock<T> desiredPitchSaturation; //!< Ограничения желаемого угла тангажа
+    SaturationBlock<T, NullMutex> desiredPitchSaturation; //!< Ограничения желаемого угла тангажа
 
     bool speedControlEnabled           = true; //!< Флаг для включения/выключения контура скорости
     bool altitudeControlEnabled        = true; //!< Флаг для включения/выключения контура высоты
@@ -46,7 +48,7 @@ public:
      */
     void setSaturationLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         desiredPitchSaturation.setLimits(min, max);
     }
 
@@ -55,7 +57,7 @@ public:
      */
     void setVelocityPidCoeffs(const T& p, const T& i, const T& d)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         velocityPid.setCoeffs(p, i, d);
     }
 
@@ -64,7 +66,7 @@ public:
      */
     void setAltitudePidCoeffs(const T& p, const T& i, const T& d)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         altitudePid.setCoeffs(p, i, d);
     }
 
@@ -73,7 +75,7 @@ public:
      */
     void setPitchAnglePidCoeffs(const T& p, const T& i, const T& d)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         pitchAnglePid.setCoeffs(p, i, d);
     }
 
@@ -82,7 +84,7 @@ public:
      */
     void setAngularVelocityPidCoeffs(const T& p, const T& i, const T& d)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         angularVelocityPid.setCoeffs(p, i, d);
     }
 
@@ -91,7 +93,7 @@ public:
      */
     void enableSpeedControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         speedControlEnabled = enable;
     }
 
@@ -100,7 +102,7 @@ public:
      */
     void enableAltitudeControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         altitudeControlEnabled = enable;
     }
 
@@ -109,7 +111,7 @@ public:
      */
     void enablePitchAngleControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         pitchAngleControlEnabled = enable;
     }
 
@@ -118,7 +120,7 @@ public:
      */
     void enableAngularVelocityControl(bool enable)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         angularVelocityControlEnabled = enable;
     }
 
@@ -140,7 +142,7 @@ public:
         const T& currentAngularVelocity,
         double dt)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
 
         T inputForPitchAngle = desiredAltitude; // Вход для контура угла тангажа
         T inputForAngularVelocity = desiredAltitude; // Вход для контура угловой скорости
@@ -191,7 +193,7 @@ public:
      */
     const std::pair<T, T>& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -200,7 +202,7 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
 
         output = std::pair<T, T>{0};
 
@@ -212,5 +214,43 @@ public:
         pitchAnglePid.reset();
         angularVelocityPid.reset();
     }
+
+    /**
+     * @brief Записать состояние регулятора (выходы, состояния ПИД регуляторов, включённые контуры) в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output.first);
+        out.write(output.second);
+        velocityPid.saveState(out);
+        altitudePid.saveState(out);
+        pitchAnglePid.saveState(out);
+        angularVelocityPid.saveState(out);
+        desiredPitchSaturation.saveState(out);
+        out.write(speedControlEnabled);
+        out.write(altitudeControlEnabled);
+        out.write(pitchAngleControlEnabled);
+        out.write(angularVelocityControlEnabled);
+    }
+
+    /**
+     * @brief Восстановить состояние регулятора (выходы, состояния ПИД регуляторов, включённые контуры) из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output.first);
+        in.read(output.second);
+        velocityPid.restoreState(in);
+        altitudePid.restoreState(in);
+        pitchAnglePid.restoreState(in);
+        angularVelocityPid.restoreState(in);
+        desiredPitchSaturation.restoreState(in);
+        in.read(speedControlEnabled);
+        in.read(altitudeControlEnabled);
+        in.read(pitchAngleControlEnabled);
+        in.read(angularVelocityControlEnabled);
+    }
 };
 }
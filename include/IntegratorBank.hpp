@@ -0,0 +1,304 @@
+#pragma once
+
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+namespace detail
+{
+/**
+ * @brief Шаг интегрирования для массива каналов
+ *
+ * Повторяет семантику IntegratorBlock::step (std::clamp) для каждого канала.
+ * Цикл не содержит ветвлений и зависимостей между итерациями, поэтому
+ * компилятор сводит его к векторным операциям сложения и выбора (blend).
+ */
+template <typename T>
+void integratorBankStep(T* __restrict state,
+                        const T* __restrict minLimit,
+                        const T* __restrict maxLimit,
+                        const T* __restrict input,
+                        const T dt,
+                        std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        T result = state[i] + input[i] * dt;
+        result   = result < minLimit[i] ? minLimit[i] : result;
+        state[i] = maxLimit[i] < result ? maxLimit[i] : result;
+    }
+}
+
+/**
+ * @brief Общая реализация банка интеграторов поверх произвольного хранилища
+ *
+ * @tparam T Тип состояния и входа
+ * @tparam Storage Контейнер для хранения массивов каналов (std::array или std::vector)
+ * @tparam Mutex Политика синхронизации доступа
+ */
+template <typename T, typename Storage, typename Mutex>
+class IntegratorBankBase
+{
+protected:
+    Mutex mtx;        //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Storage state;    //!< Состояния каналов
+    Storage minLimit; //!< Минимальные пределы интегрирования каналов
+    Storage maxLimit; //!< Максимальные пределы интегрирования каналов
+
+    IntegratorBankBase(Storage initialState, Storage initialMin, Storage initialMax)
+        : state{initialState}, minLimit{initialMin}, maxLimit{initialMax}
+    {
+    }
+
+public:
+    /**
+     * @brief Количество каналов в банке
+     */
+    std::size_t size() const
+    {
+        return state.size();
+    }
+
+    /**
+     * @brief Установить пределы интегрирования для всех каналов
+     *
+     * @param min Минимальный предел интегрирования
+     * @param max Максимальный предел интегрирования
+     */
+    void setLimits(const T& min, const T& max)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if(min > max)
+        {
+            throw std::invalid_argument("Min value should not be greater than max value");
+        }
+        std::fill(minLimit.begin(), minLimit.end(), min);
+        std::fill(maxLimit.begin(), maxLimit.end(), max);
+    }
+
+    /**
+     * @brief Установить пределы интегрирования для одного канала
+     *
+     * @param channel Номер канала
+     * @param min Минимальный предел интегрирования
+     * @param max Максимальный предел интегрирования
+     */
+    void setLimits(std::size_t channel, const T& min, const T& max)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if(min > max)
+        {
+            throw std::invalid_argument("Min value should not be greater than max value");
+        }
+        minLimit.at(channel) = min;
+        maxLimit.at(channel) = max;
+    }
+
+    /**
+     * @brief Выполнить один шаг интегрирования для всех каналов
+     *
+     * @param inputs Указатель на size() входных значений
+     * @param dt Временной шаг для интегрирования
+     */
+    void step(const T* inputs, const T& dt)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        integratorBankStep(state.data(), minLimit.data(), maxLimit.data(),
+                           inputs, dt, state.size());
+    }
+
+    /**
+     * @brief Установить состояние одного канала
+     *
+     * @param channel Номер канала
+     * @param newState Новое значение состояния для установки
+     */
+    void setState(std::size_t channel, const T& newState)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        state.at(channel) = newState;
+    }
+
+    /**
+     * @brief Ссылка на текущее состояние одного канала
+     *
+     * @param channel Номер канала
+     * @return Ссылка на текущее состояние
+     */
+    const T& getOutput(std::size_t channel)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return state.at(channel);
+    }
+
+    /**
+     * @brief Ссылка на состояния всех каналов
+     *
+     * @return Ссылка на непрерывный массив состояний
+     */
+    const Storage& getOutputs()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return state;
+    }
+
+    /**
+     * @brief Обнулить состояние одного канала
+     *
+     * @param channel Номер канала
+     */
+    void reset(std::size_t channel)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        state.at(channel) = T(0);
+    }
+
+    /**
+     * @brief Обнулить состояния всех каналов
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        std::fill(state.begin(), state.end(), T(0));
+    }
+
+    /**
+     * @brief Записать состояние всех каналов в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state.data(), state.size());
+    }
+
+    /**
+     * @brief Восстановить состояние всех каналов из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state.data(), state.size());
+    }
+};
+
+/**
+ * @brief Массив из N одинаковых значений
+ */
+template <typename T, std::size_t N>
+std::array<T, N> filledArray(const T& value)
+{
+    std::array<T, N> result;
+    result.fill(value);
+    return result;
+}
+}
+
+/**
+ * @brief Банк из N интеграторов, хранящий состояния и пределы в виде структуры массивов
+ *
+ * Каждый канал ведёт себя так же, как IntegratorBlock, но все каналы
+ * обновляются одним векторизуемым проходом.
+ *
+ * @tparam T Тип состояния и входа для блока интегрирования
+ * @tparam N Количество каналов
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, std::size_t N, typename Mutex = std::mutex>
+class IntegratorBank : public detail::IntegratorBankBase<T, std::array<T, N>, Mutex>
+{
+private:
+    using Base = detail::IntegratorBankBase<T, std::array<T, N>, Mutex>;
+
+public:
+    using Base::step;
+
+    /**
+     * @brief Конструктор с одинаковыми пределами для всех каналов
+     *
+     * @param min Минимальный предел интегрирования
+     * @param max Максимальный предел интегрирования
+     */
+    IntegratorBank(T min = static_cast<T>(-10000),
+                   T max = static_cast<T>(10000))
+        : Base{detail::filledArray<T, N>(T(0)),
+               detail::filledArray<T, N>(min),
+               detail::filledArray<T, N>(max)}
+    {
+        if(min > max)
+        {
+            throw std::invalid_argument("Min value should not be greater than max value");
+        }
+    }
+
+    /**
+     * @brief Выполнить один шаг интегрирования для всех каналов
+     *
+     * @param inputs Входные значения каналов
+     * @param dt Временной шаг для интегрирования
+     */
+    void step(const std::array<T, N>& inputs, const T& dt)
+    {
+        Base::step(inputs.data(), dt);
+    }
+};
+
+/**
+ * @brief Банк интеграторов с количеством каналов, задаваемым во время выполнения
+ *
+ * @tparam T Тип состояния и входа для блока интегрирования
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, typename Mutex = std::mutex>
+class DynamicIntegratorBank : public detail::IntegratorBankBase<T, std::vector<T>, Mutex>
+{
+private:
+    using Base = detail::IntegratorBankBase<T, std::vector<T>, Mutex>;
+
+public:
+    using Base::step;
+
+    /**
+     * @brief Конструктор с одинаковыми пределами для всех каналов
+     *
+     * @param channels Количество каналов
+     * @param min Минимальный предел интегрирования
+     * @param max Максимальный предел интегрирования
+     */
+    explicit DynamicIntegratorBank(std::size_t channels,
+                                   T min = static_cast<T>(-10000),
+                                   T max = static_cast<T>(10000))
+        : Base{std::vector<T>(channels, T(0)),
+               std::vector<T>(channels, min),
+               std::vector<T>(channels, max)}
+    {
+        if(min > max)
+        {
+            throw std::invalid_argument("Min value should not be greater than max value");
+        }
+    }
+
+    /**
+     * @brief Выполнить один шаг интегрирования для всех каналов
+     *
+     * @param inputs Входные значения каналов, размер должен совпадать с size()
+     * @param dt Временной шаг для интегрирования
+     */
+    void step(const std::vector<T>& inputs, const T& dt)
+    {
+        if (inputs.size() != this->size())
+        {
+            throw std::invalid_argument("Inputs size should match the number of channels");
+        }
+        Base::step(inputs.data(), dt);
+    }
+};
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
 #include <algorithm>
 #include <mutex>
 #include <stdexcept>
@@ -11,12 +14,13 @@ namespace SimulinkBlock
  * @brief Класс, реализующий блок интегрирования
  *
  * @tparam T Тип состояния и входа для блока интегрирования
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex>
 class IntegratorBlock
 {
 private:
-    std::mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx;      //!< Мьютекс для блокировки одновременного доступа к переменным класса
     T state;        //!< Состояние блока интегрирования
     T minLimit;     //!< Минимальный предел интегрирования
     T maxLimit;     //!< Максимальный предел интегрирования
@@ -35,7 +39,7 @@ public:
           maxLimit{max},
           state{T(0)}
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         if(min > max)
         {
             std::swap(minLimit, maxLimit);
@@ -51,7 +55,7 @@ public:
      */
     void setLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         if(min > max)
         {
             std::swap(maxLimit, minLimit);
@@ -70,10 +74,26 @@ public:
      */
     void step(const T& input, const T& dt)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
+        process(input, dt);
+    }
+
+    /**
+     * @brief Выполнить шаг интегрирования без блокировки мьютекса
+     *
+     * Используется при слиянии блоков в цепочку (chain), когда доступ к блоку
+     * уже принадлежит одному потоку.
+     *
+     * @param input Входное значение для интегрирования
+     * @param dt Временной шаг для интегрирования
+     * @return Новое состояние блока
+     */
+    T process(const T& input, const T& dt)
+    {
         // Ограничиваем результат интегрирования
         T result = state + input * dt;
         state = std::clamp(result, minLimit, maxLimit);
+        return state;
     }
 
     /**
@@ -83,10 +103,25 @@ public:
      */
     void setState(const T& newState)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         state = newState;
     }
 
+    /**
+     * @brief Установить состояние, ограниченное пределами интегрирования
+     *
+     * Используется решателями, которые вычисляют состояние сами (ContinuousModel).
+     *
+     * @param newState Новое значение состояния
+     * @return Установленное значение
+     */
+    T setClampedState(const T& newState)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        state = std::clamp(newState, minLimit, maxLimit);
+        return state;
+    }
+
     /**
      * @brief Ссылка на текущее состояние блока интегрирования
      *
@@ -94,7 +129,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return state;
     }
 
@@ -103,8 +138,26 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         state = T(0);
     }
+
+    /**
+     * @brief Записать состояние блока интегрирования в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state);
+    }
+
+    /**
+     * @brief Восстановить состояние блока интегрирования из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state);
+    }
 };
 }
@@ -1,71 +1,630 @@
 #pragma once
 
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
 #include <array>
 #include <algorithm>
+#include <limits>
 #include <mutex>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 
 namespace SimulinkBlock
 {
+/**
+ * @brief Способ поиска отрезка таблицы
+ */
+enum class BreakpointSpacing
+{
+    Auto,       //!< Определить по входным значениям таблицы при создании
+    NonUniform, //!< Двоичный поиск по произвольно расположенным точкам
+    Uniform     //!< Вычисление индекса для равномерно расположенных точек
+};
+
+/**
+ * @brief Подсказка отрезка для поиска в таблице
+ *
+ * Хранит отрезок, найденный при прошлом поиске, и счётчики попаданий.
+ * При медленно меняющемся входе следующий поиск начинается с этого отрезка.
+ */
+struct SegmentHint
+{
+    std::size_t segment = 0; //!< Отрезок, найденный при прошлом поиске
+    std::size_t hits    = 0; //!< Количество поисков, завершённых в прошлом или соседнем отрезке
+    std::size_t misses  = 0; //!< Количество поисков, потребовавших двоичного поиска
+
+    /**
+     * @brief Доля поисков, завершённых без двоичного поиска
+     */
+    double hitRate() const
+    {
+        std::size_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+namespace detail
+{
+/**
+ * @brief Модуль числа, вычисляемый на этапе компиляции
+ */
+template <typename T>
+constexpr T absolute(const T& value)
+{
+    return value < T(0) ? -value : value;
+}
+
+/**
+ * @brief Проверить, что точки таблицы расположены с постоянным шагом
+ *
+ * @param inputs Входные значения таблицы
+ * @param size Количество точек
+ */
+template <typename T>
+constexpr bool isEvenlySpaced(const T* inputs, std::size_t size)
+{
+    T step = (inputs[size - 1] - inputs[0]) / static_cast<T>(size - 1);
+    T tolerance = std::numeric_limits<T>::epsilon() * static_cast<T>(4 * size)
+                * std::max(absolute(inputs[0]), absolute(inputs[size - 1]));
+
+    if (!(step > T(0)))
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        T expected = inputs[0] + step * static_cast<T>(i);
+        if (absolute(inputs[i] - expected) > tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Величина, обратная шагу равномерной таблицы
+ *
+ * Возвращает ноль, если обратная величина не представима в типе T с
+ * точностью, достаточной для вычисления индекса отрезка (например, для
+ * целочисленной таблицы с шагом больше единицы). В этом случае таблица
+ * использует двоичный поиск.
+ *
+ * @param inputs Равномерно расположенные входные значения таблицы
+ * @param size Количество точек
+ */
+template <typename T>
+constexpr T uniformInverseSpacing(const T* inputs, std::size_t size)
+{
+    const T span    = inputs[size - 1] - inputs[0];
+    const T inverse = static_cast<T>(size - 1) / span;
+    const T tolerance = std::numeric_limits<T>::epsilon() * static_cast<T>(4 * size * (size - 1));
+
+    if (!(inverse > T(0)) || absolute(span * inverse - static_cast<T>(size - 1)) > tolerance)
+    {
+        return T(0);
+    }
+    return inverse;
+}
+
+/**
+ * @brief Представление одномерной таблицы поверх непрерывных массивов
+ *
+ * Содержит всю логику поиска отрезка и интерполяции и не владеет данными,
+ * поэтому используется таблицами с разным способом хранения.
+ */
+template <typename T>
+struct Lookup1DView
+{
+    const T* inputs;       //!< Входные значения таблицы (size элементов)
+    const T* outputs;      //!< Выходные значения таблицы (size элементов)
+    const T* slopes;       //!< Наклоны отрезков таблицы (size - 1 элементов)
+    std::size_t size;      //!< Количество точек таблицы
+    bool uniform;          //!< Признак равномерного расположения входных значений
+    T inverseSpacing;      //!< Величина, обратная шагу равномерной таблицы
+
+    static constexpr std::size_t batchSize = 64; //!< Размер пачки для пакетной интерполяции
+
+    /**
+     * @brief Найти отрезок таблицы для входного значения
+     *
+     * Значения ниже таблицы относятся к первому отрезку, выше таблицы - к последнему.
+     *
+     * @param inputValue Входное значение
+     * @return Индекс левой точки отрезка в диапазоне [0, size - 2]
+     */
+    constexpr std::size_t findSegment(const T& inputValue) const
+    {
+        if (uniform)
+        {
+            T position = (inputValue - inputs[0]) * inverseSpacing;
+            if (!(position > T(0)))
+            {
+                return 0;
+            }
+            return position < static_cast<T>(size - 2) ? static_cast<std::size_t>(position) : size - 2;
+        }
+
+        // Аналог std::upper_bound по точкам [1, size - 2], допустимый в constexpr
+        std::size_t first = 1;
+        std::size_t count = size - 2;
+        while (count > 0)
+        {
+            std::size_t half = count / 2;
+            if (!(inputValue < inputs[first + half]))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+            {
+                count = half;
+            }
+        }
+        return first - 1;
+    }
+
+    /**
+     * @brief Найти отрезок таблицы, начиная с отрезка из подсказки
+     *
+     * Проверяется отрезок из подсказки и соседние с ним, при большом скачке
+     * входа выполняется двоичный поиск. Для равномерной таблицы индекс
+     * вычисляется напрямую, а счётчики подсказки не изменяются.
+     *
+     * @param inputValue Входное значение
+     * @param hint Подсказка, обновляемая найденным отрезком
+     * @return Индекс левой точки отрезка в диапазоне [0, size - 2]
+     */
+    std::size_t findSegment(const T& inputValue, SegmentHint& hint) const
+    {
+        if (uniform)
+        {
+            hint.segment = findSegment(inputValue);
+            return hint.segment;
+        }
+
+        const std::size_t last = size - 2;
+        std::size_t segment = std::min(hint.segment, last);
+
+        if (!containsInput(segment, inputValue))
+        {
+            if (segment < last && containsInput(segment + 1, inputValue))
+            {
+                ++segment;
+            }
+            else if (segment > 0 && containsInput(segment - 1, inputValue))
+            {
+                --segment;
+            }
+            else
+            {
+                hint.segment = findSegment(inputValue);
+                ++hint.misses;
+                return hint.segment;
+            }
+        }
+
+        hint.segment = segment;
+        ++hint.hits;
+        return segment;
+    }
+
+    /**
+     * @brief Интерполяция (экстраполяция за пределами таблицы) одного значения
+     *
+     * Для целочисленного T наклон отрезка не представим, поэтому значение
+     * вычисляется по точкам отрезка с делением в конце.
+     */
+    constexpr T evaluate(const T& inputValue, std::size_t segment) const
+    {
+        if constexpr (std::numeric_limits<T>::is_integer)
+        {
+            return outputs[segment] + (outputs[segment + 1] - outputs[segment]) * (inputValue - inputs[segment])
+                                    / (inputs[segment + 1] - inputs[segment]);
+        }
+        else
+        {
+            return outputs[segment] + slopes[segment] * (inputValue - inputs[segment]);
+        }
+    }
+
+    /**
+     * @brief Интерполяция одного значения
+     */
+    constexpr T evaluate(const T& inputValue) const
+    {
+        return evaluate(inputValue, findSegment(inputValue));
+    }
+
+    /**
+     * @brief Интерполяция массива значений
+     *
+     * @param inputValues Указатель на count входных значений
+     * @param outputValues Указатель на count выходных значений
+     * @param count Количество значений
+     */
+    void evaluate(const T* inputValues, T* outputValues, std::size_t count) const
+    {
+        std::size_t done = evaluateSimd(inputValues, outputValues, count);
+
+        std::array<std::size_t, batchSize> segments;
+        for (std::size_t begin = done; begin < count; begin += batchSize)
+        {
+            const std::size_t length = std::min(batchSize, count - begin);
+            const T* x = inputValues + begin;
+            T* y = outputValues + begin;
+
+            findSegments(x, segments.data(), length);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                y[i] = evaluate(x[i], segments[i]);
+            }
+        }
+    }
+
+private:
+    /**
+     * @brief Относится ли входное значение к отрезку так же, как при двоичном поиске
+     */
+    bool containsInput(std::size_t segment, const T& inputValue) const
+    {
+        bool aboveStart = segment == 0 || !(inputValue < inputs[segment]);
+        bool belowEnd   = segment == size - 2 || inputValue < inputs[segment + 1];
+        return aboveStart && belowEnd;
+    }
+
+    /**
+     * @brief Найти отрезки таблицы для пачки входных значений
+     *
+     * Для неравномерной таблицы используется двоичный поиск без ветвлений:
+     * на каждой итерации все элементы пачки сужают диапазон на одну и ту же
+     * длину, поэтому число итераций постоянно и внутренний цикл векторизуется.
+     */
+    void findSegments(const T* inputValues, std::size_t* segments, std::size_t length) const
+    {
+        if (uniform)
+        {
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                segments[i] = findSegment(inputValues[i]);
+            }
+            return;
+        }
+
+        std::fill(segments, segments + length, std::size_t(0));
+        for (std::size_t range = size - 1; range > 1; )
+        {
+            const std::size_t half = range / 2;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                const std::size_t probe = segments[i] + half;
+                segments[i] = inputs[probe] <= inputValues[i] ? probe : segments[i];
+            }
+            range -= half;
+        }
+    }
+
+    /**
+     * @brief Векторная интерполяция массива значений
+     *
+     * @return Количество обработанных значений, начиная с нулевого
+     */
+    std::size_t evaluateSimd(const T*, T*, std::size_t) const
+    {
+        return 0;
+    }
+};
+
+#if defined(__AVX2__)
+/**
+ * @brief Интерполяция массива значений типа double инструкциями AVX2
+ *
+ * Индексы отрезков вычисляются по четыре за раз, точки таблицы выбираются
+ * инструкциями gather, ограничение индекса и выбор половины при двоичном
+ * поиске выполняются без ветвлений. Порядок операций совпадает со скалярным,
+ * поэтому результат побитово совпадает с evaluate() при сборке без FMA.
+ */
+template <>
+inline std::size_t Lookup1DView<double>::evaluateSimd(const double* inputValues,
+                                                      double* outputValues,
+                                                      std::size_t count) const
+{
+    const __m256d first       = _mm256_set1_pd(inputs[0]);
+    const __m256d inverse     = _mm256_set1_pd(inverseSpacing);
+    const __m256d zero        = _mm256_setzero_pd();
+    const __m256d lastSegment = _mm256_set1_pd(static_cast<double>(size - 2));
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d x = _mm256_loadu_pd(inputValues + i);
+        __m256i segment;
+
+        if (uniform)
+        {
+            // max/min возвращают второй операнд для NaN, что совпадает с findSegment
+            __m256d position = _mm256_mul_pd(_mm256_sub_pd(x, first), inverse);
+            position = _mm256_min_pd(_mm256_max_pd(position, zero), lastSegment);
+            segment  = _mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(position));
+        }
+        else
+        {
+            segment = _mm256_setzero_si256();
+            for (std::size_t range = size - 1; range > 1; )
+            {
+                const std::size_t half = range / 2;
+                const __m256i probe = _mm256_add_epi64(segment, _mm256_set1_epi64x(static_cast<long long>(half)));
+                const __m256d probeInput = _mm256_i64gather_pd(inputs, probe, 8);
+                const __m256d mask = _mm256_cmp_pd(probeInput, x, _CMP_LE_OQ);
+                segment = _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(segment),
+                                                               _mm256_castsi256_pd(probe), mask));
+                range -= half;
+            }
+        }
+
+        const __m256d x0    = _mm256_i64gather_pd(inputs, segment, 8);
+        const __m256d y0    = _mm256_i64gather_pd(outputs, segment, 8);
+        const __m256d slope = _mm256_i64gather_pd(slopes, segment, 8);
+        _mm256_storeu_pd(outputValues + i, _mm256_add_pd(y0, _mm256_mul_pd(slope, _mm256_sub_pd(x, x0))));
+    }
+    return i;
+}
+#endif
+}
+
+/**
+ * @brief Неизменяемая одномерная таблица поиска, создаваемая на этапе компиляции
+ *
+ * Тип литеральный: таблица, объявленная как static constexpr, проверяется
+ * и вычисляется компилятором (наклоны отрезков, признак равномерной сетки)
+ * и размещается в секции данных только для чтения. Если входные значения
+ * не возрастают строго, конструктор выбрасывает исключение, что при
+ * constexpr-инициализации становится ошибкой компиляции.
+ *
+ * @code
+ * static constexpr StaticLookupTable1D<double, 3> liftCurve{{0.0, 5.0, 10.0}, {0.1, 0.6, 1.0}};
+ * static_assert(liftCurve.interpolate(2.5) > 0.3);
+ * @endcode
+ *
+ * @tparam T Тип данных массива и возвращаемого значения
+ * @tparam N Количество точек таблицы
+ */
+template <typename T, std::size_t N>
+class StaticLookupTable1D
+{
+    static_assert(N >= 2, "Lookup table should contain at least two points");
+
+private:
+    std::array<T, N> tableInputs{};  //!< Входные значения таблицы
+    std::array<T, N> tableOutputs{}; //!< Выходные значения таблицы
+    std::array<T, N - 1> slopes{};   //!< Наклоны отрезков таблицы
+    bool uniform = false;            //!< Признак равномерного расположения входных значений
+    T inverseSpacing = T(0);         //!< Величина, обратная шагу равномерной таблицы
+
+public:
+    /**
+     * @brief Конструктор таблицы
+     *
+     * @param inputs Строго возрастающие входные значения
+     * @param outputs Соответствующие выходные значения
+     * @param spacing Способ поиска отрезка таблицы
+     */
+    constexpr StaticLookupTable1D(const std::array<T, N>& inputs,
+                                  const std::array<T, N>& outputs,
+                                  BreakpointSpacing spacing = BreakpointSpacing::Auto)
+        : tableInputs{inputs}, tableOutputs{outputs}
+    {
+        if (!isStrictlyIncreasing(inputs))
+        {
+            throw std::invalid_argument("Table inputs should be strictly increasing");
+        }
+
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            slopes[i] = (tableOutputs[i + 1] - tableOutputs[i]) / (tableInputs[i + 1] - tableInputs[i]);
+        }
+
+        T inverse = detail::isEvenlySpaced(tableInputs.data(), N)
+                  ? detail::uniformInverseSpacing(tableInputs.data(), N) : T(0);
+        if (spacing == BreakpointSpacing::Uniform && !(inverse > T(0)))
+        {
+            throw std::invalid_argument("Table inputs are not evenly spaced");
+        }
+
+        uniform = spacing != BreakpointSpacing::NonUniform && inverse > T(0);
+        if (uniform)
+        {
+            inverseSpacing = inverse;
+        }
+    }
+
+    /**
+     * @brief Проверить, что входные значения строго возрастают
+     *
+     * Может использоваться в static_assert до создания таблицы.
+     */
+    static constexpr bool isStrictlyIncreasing(const std::array<T, N>& inputs)
+    {
+        for (std::size_t i = 0; i + 1 < N; ++i)
+        {
+            if (!(inputs[i] < inputs[i + 1]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Интерполяция значения (линейная экстраполяция за пределами таблицы)
+     *
+     * @param inputValue Входное значение
+     * @return Интерполированное значение
+     */
+    constexpr T interpolate(const T& inputValue) const
+    {
+        return view().evaluate(inputValue);
+    }
+
+    /**
+     * @brief Используется ли вычисление индекса для равномерной таблицы
+     */
+    constexpr bool isUniform() const
+    {
+        return uniform;
+    }
+
+    /**
+     * @brief Представление таблицы для функций поиска и интерполяции
+     */
+    constexpr detail::Lookup1DView<T> view() const
+    {
+        return {tableInputs.data(), tableOutputs.data(), slopes.data(), N, uniform, inverseSpacing};
+    }
+};
+
 /**
  * @brief Класс для работы с одномерной таблицей поиска
  *
+ * При создании для каждого отрезка таблицы заранее вычисляется наклон.
+ * Если точки таблицы расположены равномерно, индекс отрезка вычисляется
+ * арифметически за O(1), иначе используется двоичный поиск.
+ *
  * @tparam T Тип данных массива и возвращаемого значения
  * @tparam N Тип размера массива
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename Mutex = std::mutex>
 class LookupTable1D
 {
 private:
-    std::mutex mtx;                //!< Мьютекс для блокировки одновременного доступа к переменным класса
-    std::array<T, N> tableInputs;  //!< Входные значения таблицы
-    std::array<T, N> tableOutputs; //!< Выходные значения таблицы
-    T output = T(0);               //!< Значение, экстраполированное из таблицы
+    Mutex mtx;                      //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    StaticLookupTable1D<T, N> data; //!< Точки таблицы и наклоны отрезков
+    T output = T(0);                //!< Значение, экстраполированное из таблицы
+    bool hintEnabled = false;       //!< Признак поиска отрезка с подсказкой
+    SegmentHint hint;               //!< Подсказка отрезка для поиска с подсказкой
 
 public:
     /**
      * @brief Конструктор класса LookupTable1D.
-     * @param inputs Вектор входных значений.
+     * @param inputs Вектор строго возрастающих входных значений.
      * @param outputs Вектор соответствующих выходных значений.
+     * @param spacing Способ поиска отрезка таблицы.
      */
-    LookupTable1D(const std::array<T, N>& inputs, const std::array<T, N>& outputs)
-        : tableInputs{inputs}, tableOutputs{outputs}
+    LookupTable1D(const std::array<T, N>& inputs,
+                  const std::array<T, N>& outputs,
+                  BreakpointSpacing spacing = BreakpointSpacing::Auto)
+        : data{inputs, outputs, spacing}
+    {
+    }
+
+    /**
+     * @brief Конструктор класса LookupTable1D по таблице, вычисленной на этапе компиляции.
+     * @param table Таблица с заранее вычисленными наклонами.
+     */
+    explicit LookupTable1D(const StaticLookupTable1D<T, N>& table)
+        : data{table}
     {
     }
 
     /**
      * @brief Интерполяция значения на основе входного значения.
+     *
+     * За пределами таблицы значение линейно экстраполируется по крайнему отрезку.
+     *
      * @param inputValue Входное значение для интерполяции.
      */
     void interpolate(const T& inputValue)
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        if (inputValue < tableInputs.front() || inputValue > tableInputs.back())
+        std::lock_guard<Mutex> lock(mtx);
+        output = process(inputValue);
+    }
+
+    /**
+     * @brief Интерполяция без блокировки мьютекса и без записи выхода блока
+     *
+     * Используется при слиянии блоков в цепочку (chain). Подсказка отрезка,
+     * если она включена, обновляется так же, как в interpolate(inputValue).
+     *
+     * @param inputValue Входное значение для интерполяции
+     * @return Интерполированное значение
+     */
+    T process(const T& inputValue)
+    {
+        if (hintEnabled)
         {
-            // Значение находится за пределами таблицы, поэтому экстраполировать
-            extrapolate(inputValue);
+            return view().evaluate(inputValue, view().findSegment(inputValue, hint));
         }
-        else
-        {
-            auto it = std::upper_bound(tableInputs.begin(), tableInputs.end(), inputValue);
-            if (it == tableInputs.begin())
-            {
-                output = tableOutputs.front();
-            }
-            if (it == tableInputs.end())
-            {
-                output = tableOutputs.back();
-            }
+        return view().evaluate(inputValue);
+    }
 
-            size_t idx = it - tableInputs.begin();
-            T x0 = tableInputs[idx - 1];
-            T x1 = tableInputs[idx];
-            T y0 = tableOutputs[idx - 1];
-            T y1 = tableOutputs[idx];
+    /**
+     * @brief Интерполяция значения с подсказкой, принадлежащей вызывающей стороне
+     *
+     * Не изменяет выход блока и не захватывает мьютекс, поэтому одну таблицу
+     * могут использовать несколько регуляторов, каждый со своей подсказкой.
+     *
+     * @param inputValue Входное значение для интерполяции
+     * @param segmentHint Подсказка отрезка, обновляемая при поиске
+     * @return Интерполированное значение
+     */
+    T interpolate(const T& inputValue, SegmentHint& segmentHint) const
+    {
+        const auto table = view();
+        return table.evaluate(inputValue, table.findSegment(inputValue, segmentHint));
+    }
 
-            // Линейная интерполяция
-            output = y0 + (y1 - y0) * (inputValue - x0) / (x1 - x0);
-        }
+    /**
+     * @brief Включить/выключить поиск отрезка с подсказкой для interpolate(inputValue)
+     *
+     * Подходит для медленно меняющихся входов (скорость, высота): поиск
+     * начинается с отрезка, найденного на прошлом шаге.
+     */
+    void enableSegmentHint(bool enable)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        hintEnabled = enable;
+        hint = SegmentHint{};
+    }
+
+    /**
+     * @brief Получить подсказку отрезка со счётчиками попаданий
+     */
+    SegmentHint getSegmentHint()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return hint;
+    }
+
+    /**
+     * @brief Интерполяция массива входных значений
+     *
+     * Не изменяет выход блока и не захватывает мьютекс: таблица не меняется
+     * после создания. Для double при сборке с AVX2 используется векторная
+     * реализация, иначе значения обрабатываются пачками с поиском отрезка
+     * без ветвлений.
+     *
+     * @param inputs Указатель на count входных значений
+     * @param outputs Указатель на count выходных значений
+     * @param count Количество значений
+     */
+    void interpolate(const T* inputs, T* outputs, std::size_t count) const
+    {
+        view().evaluate(inputs, outputs, count);
+    }
+
+    /**
+     * @brief Используется ли вычисление индекса для равномерной таблицы
+     */
+    bool isUniform() const
+    {
+        return data.isUniform();
     }
 
     /**
@@ -75,7 +634,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -84,41 +643,40 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         output = T(0);
     }
 
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+        out.write(hintEnabled);
+        out.write(hint);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+        in.read(hintEnabled);
+        in.read(hint);
+    }
+
 private:
 
     /**
-     * @brief Экстраполяция значения на основе входного значения
-     * @param inputValue Входное значение для экстраполяции
+     * @brief Представление таблицы для функций поиска и интерполяции
      */
-    void extrapolate(const T& inputValue)
+    detail::Lookup1DView<T> view() const
     {
-        if (inputValue < tableInputs.front())
-        {
-            // Линейная экстраполяция для значений ниже таблицы
-            T x0 = tableInputs.front();
-            T x1 = tableInputs[1];
-            T y0 = tableOutputs.front();
-            T y1 = tableOutputs[1];
-            output = y0 + (y1 - y0) * (inputValue - x0) / (x1 - x0);
-        }
-        else if (inputValue > tableInputs.back())
-        {
-            // Линейная экстраполяция для значений выше таблицы
-            T x0 = tableInputs[tableInputs.size() - 2];
-            T x1 = tableInputs.back();
-            T y0 = tableOutputs[tableOutputs.size() - 2];
-            T y1 = tableOutputs.back();
-            output = y0 + (y1 - y0) * (inputValue - x0) / (x1 - x0);
-        }
-        else
-        {
-            // Значение находится в пределах таблицы, поэтому интерполировать
-            interpolate(inputValue);
-        }
+        return data.view();
     }
 };
 }
@@ -0,0 +1,318 @@
+#pragma once
+
+#include "LookupTable1D.hpp"
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Результат поиска по вектору точек: индекс отрезка и доля внутри него
+ *
+ * @tparam T Тип доли
+ */
+template <typename T>
+struct PrelookupResult
+{
+    std::size_t index = 0; //!< Индекс левой точки отрезка
+    T fraction = T(0);     //!< Доля внутри отрезка (вне [0, 1] при экстраполяции)
+};
+
+/**
+ * @brief Класс, реализующий блок Prelookup
+ *
+ * Вычисляет индекс отрезка и долю внутри него для одного вектора точек.
+ * Результат передаётся в LookupTableND::interpolatePrelookup всех таблиц,
+ * которые разделяют этот вектор точек (например, число Маха), поэтому
+ * поиск по нему выполняется один раз за шаг.
+ *
+ * @tparam T Тип точек и входного значения
+ * @tparam N Количество точек
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, std::size_t N, typename Mutex = std::mutex>
+class Prelookup
+{
+    static_assert(N >= 2, "Breakpoint vector should contain at least two points");
+
+private:
+    Mutex mtx;                         //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    std::array<T, N> breakpoints;      //!< Точки вектора
+    bool uniform = false;              //!< Признак равномерного расположения точек
+    T inverseSpacing = T(0);           //!< Величина, обратная шагу равномерного вектора
+    PrelookupResult<T> output;         //!< Результат последнего поиска
+
+public:
+    /**
+     * @brief Конструктор блока Prelookup
+     *
+     * @param points Строго возрастающие точки вектора
+     * @param spacing Способ поиска отрезка
+     */
+    explicit Prelookup(const std::array<T, N>& points,
+                       BreakpointSpacing spacing = BreakpointSpacing::Auto)
+        : breakpoints{points}
+    {
+        if (!StaticLookupTable1D<T, N>::isStrictlyIncreasing(breakpoints))
+        {
+            throw std::invalid_argument("Breakpoints should be strictly increasing");
+        }
+
+        T inverse = detail::isEvenlySpaced(breakpoints.data(), N)
+                  ? detail::uniformInverseSpacing(breakpoints.data(), N) : T(0);
+        if (spacing == BreakpointSpacing::Uniform && !(inverse > T(0)))
+        {
+            throw std::invalid_argument("Breakpoints are not evenly spaced");
+        }
+
+        uniform = spacing != BreakpointSpacing::NonUniform && inverse > T(0);
+        if (uniform)
+        {
+            inverseSpacing = inverse;
+        }
+    }
+
+    /**
+     * @brief Выполнить поиск для входного значения
+     *
+     * @param input Входное значение
+     */
+    void step(const T& input)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = locate(input);
+    }
+
+    /**
+     * @brief Найти индекс и долю без изменения выхода блока
+     *
+     * @param input Входное значение
+     * @return Индекс отрезка и доля внутри него
+     */
+    PrelookupResult<T> locate(const T& input) const
+    {
+        const detail::Lookup1DView<T> view{breakpoints.data(), nullptr, nullptr, N, uniform, inverseSpacing};
+        const std::size_t index = view.findSegment(input);
+        return {index, (input - breakpoints[index]) / (breakpoints[index + 1] - breakpoints[index])};
+    }
+
+    /**
+     * @brief Ссылка на результат последнего поиска
+     */
+    const PrelookupResult<T>& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить результат поиска
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = PrelookupResult<T>{};
+    }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+    }
+};
+
+/**
+ * @brief Класс для работы с многомерной таблицей поиска
+ *
+ * Значения таблицы хранятся непрерывно в порядке строк (последнее измерение
+ * меняется быстрее всего). Между точками выполняется полилинейная интерполяция,
+ * за пределами таблицы - линейная экстраполяция по крайним отрезкам.
+ *
+ * @tparam T Тип данных таблицы и возвращаемого значения
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ * @tparam Dims Количество точек по каждому измерению
+ */
+template <typename T, typename Mutex, std::size_t... Dims>
+class BasicLookupTableND
+{
+public:
+    static constexpr std::size_t dimensions = sizeof...(Dims);    //!< Количество измерений
+    static constexpr std::size_t size       = (Dims * ... * 1);   //!< Количество значений таблицы
+
+    using Prelookups = std::array<PrelookupResult<T>, dimensions>; //!< Результаты поиска по всем измерениям
+
+    static_assert(dimensions >= 1, "Lookup table should have at least one dimension");
+
+private:
+    static constexpr std::array<std::size_t, dimensions> extents = {Dims...}; //!< Размеры измерений
+
+    Mutex mtx;                                         //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    std::tuple<Prelookup<T, Dims, NullMutex>...> axes; //!< Поиск по векторам точек каждого измерения
+    std::array<T, size> values;                        //!< Значения таблицы в порядке строк
+    std::array<std::size_t, dimensions> strides;       //!< Шаги по массиву значений для каждого измерения
+    T output = T(0);                                   //!< Значение, интерполированное из таблицы
+
+public:
+    /**
+     * @brief Конструктор многомерной таблицы
+     *
+     * @param breakpoints Строго возрастающие векторы точек для каждого измерения
+     * @param tableValues Значения таблицы в порядке строк
+     */
+    BasicLookupTableND(const std::array<T, Dims>&... breakpoints, const std::array<T, size>& tableValues)
+        : axes{Prelookup<T, Dims, NullMutex>{breakpoints}...}, values{tableValues}
+    {
+        std::size_t stride = 1;
+        for (std::size_t d = dimensions; d-- > 0; )
+        {
+            strides[d] = stride;
+            stride *= extents[d];
+        }
+    }
+
+    /**
+     * @brief Интерполяция по результатам внешних блоков Prelookup
+     *
+     * @param prelookups Индексы и доли для каждого измерения
+     */
+    void interpolatePrelookup(const Prelookups& prelookups)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = evaluate(prelookups);
+    }
+
+    /**
+     * @brief Интерполяция по входным значениям каждого измерения
+     *
+     * @param inputs Входные значения для каждого измерения
+     */
+    void interpolate(const std::array<T, dimensions>& inputs)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = evaluate(locate(inputs, std::make_index_sequence<dimensions>{}));
+    }
+
+    /**
+     * @brief Полилинейная интерполяция без изменения выхода блока
+     *
+     * Индекс каждого измерения должен указывать на отрезок таблицы, то есть
+     * быть меньше extents[d] - 1, иначе выбрасывается std::out_of_range.
+     *
+     * @param prelookups Индексы и доли для каждого измерения
+     * @return Интерполированное значение
+     */
+    T evaluate(const Prelookups& prelookups) const
+    {
+        constexpr std::size_t corners = std::size_t(1) << dimensions;
+
+        std::size_t base = 0;
+        for (std::size_t d = 0; d < dimensions; ++d)
+        {
+            if (prelookups[d].index + 1 >= extents[d])
+            {
+                throw std::out_of_range("Prelookup index is out of range");
+            }
+            base += prelookups[d].index * strides[d];
+        }
+
+        // Значения в вершинах ячейки: бит d номера вершины отвечает измерению d
+        std::array<T, corners> corner;
+        for (std::size_t c = 0; c < corners; ++c)
+        {
+            std::size_t offset = base;
+            for (std::size_t d = 0; d < dimensions; ++d)
+            {
+                offset += ((c >> d) & 1u) * strides[d];
+            }
+            corner[c] = values[offset];
+        }
+
+        // Последовательная линейная интерполяция по каждому измерению
+        for (std::size_t d = 0, count = corners; d < dimensions; ++d)
+        {
+            count /= 2;
+            const T fraction = prelookups[d].fraction;
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                corner[j] = corner[2 * j] + fraction * (corner[2 * j + 1] - corner[2 * j]);
+            }
+        }
+        return corner[0];
+    }
+
+    /**
+     * @brief Ссылка на текущее значение, интерполированное из таблицы
+     */
+    const T& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить текущий выход блока
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = T(0);
+    }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+    }
+
+private:
+    /**
+     * @brief Выполнить поиск по векторам точек всех измерений
+     */
+    template <std::size_t... Axis>
+    Prelookups locate(const std::array<T, dimensions>& inputs, std::index_sequence<Axis...>) const
+    {
+        return {std::get<Axis>(axes).locate(inputs[Axis])...};
+    }
+};
+
+/**
+ * @brief Многомерная таблица поиска с синхронизацией std::mutex
+ *
+ * @tparam T Тип данных таблицы и возвращаемого значения
+ * @tparam Dims Количество точек по каждому измерению
+ */
+template <typename T, std::size_t... Dims>
+using LookupTableND = BasicLookupTableND<T, std::mutex, Dims...>;
+}
@@ -0,0 +1,335 @@
+#pragma once
+
+#include "LookupTable1D.hpp"
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Заголовок бинарного файла одномерной таблицы
+ *
+ * Файл состоит из заголовка и трёх массивов в порядке байтов платформы:
+ * входные значения (count), выходные значения (count) и наклоны отрезков
+ * (count - 1). Каждый массив начинается со смещения, кратного 64 байтам,
+ * поэтому после отображения файла в память данные готовы к использованию
+ * без разбора и копирования.
+ */
+struct LookupTableFileHeader
+{
+    static constexpr char          signature[8]  = {'S', 'B', 'L', 'U', 'T', '1', 'D', '\0'}; //!< Сигнатура файла
+    static constexpr std::uint32_t currentVersion = 1;  //!< Текущая версия формата
+    static constexpr std::uint32_t uniformFlag    = 1u; //!< Флаг равномерного расположения точек
+    static constexpr std::uint64_t alignment      = 64; //!< Выравнивание массивов в файле
+
+    char          magic[8];       //!< Сигнатура файла
+    std::uint32_t version;        //!< Версия формата
+    std::uint32_t valueSize;      //!< Размер одного значения в байтах (4 - float, 8 - double)
+    std::uint64_t count;          //!< Количество точек таблицы
+    std::uint32_t flags;          //!< Флаги таблицы
+    std::uint32_t reserved;       //!< Зарезервировано
+    double        inverseSpacing; //!< Величина, обратная шагу равномерной таблицы
+    std::uint64_t inputsOffset;   //!< Смещение массива входных значений
+    std::uint64_t outputsOffset;  //!< Смещение массива выходных значений
+    std::uint64_t slopesOffset;   //!< Смещение массива наклонов
+    std::uint64_t fileSize;       //!< Полный размер файла
+};
+
+/**
+ * @brief Записать одномерную таблицу в бинарный файл для MappedLookupTable1D
+ *
+ * @tparam T Тип значений таблицы (float или double)
+ * @param path Путь к создаваемому файлу
+ * @param inputs Строго возрастающие входные значения
+ * @param outputs Соответствующие выходные значения
+ */
+template <typename T>
+void writeLookupTableFile(const std::string& path, const std::vector<T>& inputs, const std::vector<T>& outputs)
+{
+    static_assert(std::is_floating_point<T>::value, "Table values should be float or double");
+
+    if (inputs.size() < 2 || inputs.size() != outputs.size())
+    {
+        throw std::invalid_argument("Table should contain at least two points and equal-sized columns");
+    }
+    for (std::size_t i = 0; i + 1 < inputs.size(); ++i)
+    {
+        if (!(inputs[i] < inputs[i + 1]))
+        {
+            throw std::invalid_argument("Table inputs should be strictly increasing");
+        }
+    }
+
+    std::vector<T> slopes(inputs.size() - 1);
+    for (std::size_t i = 0; i < slopes.size(); ++i)
+    {
+        slopes[i] = (outputs[i + 1] - outputs[i]) / (inputs[i + 1] - inputs[i]);
+    }
+
+    auto align = [](std::uint64_t offset)
+    {
+        return (offset + LookupTableFileHeader::alignment - 1) / LookupTableFileHeader::alignment
+               * LookupTableFileHeader::alignment;
+    };
+
+    LookupTableFileHeader header{};
+    std::memcpy(header.magic, LookupTableFileHeader::signature, sizeof(header.magic));
+    header.version       = LookupTableFileHeader::currentVersion;
+    header.valueSize     = sizeof(T);
+    header.count         = inputs.size();
+    header.inputsOffset  = align(sizeof(LookupTableFileHeader));
+    header.outputsOffset = align(header.inputsOffset + inputs.size() * sizeof(T));
+    header.slopesOffset  = align(header.outputsOffset + outputs.size() * sizeof(T));
+    header.fileSize      = header.slopesOffset + slopes.size() * sizeof(T);
+
+    const T inverse = detail::isEvenlySpaced(inputs.data(), inputs.size())
+                    ? detail::uniformInverseSpacing(inputs.data(), inputs.size()) : T(0);
+    if (inverse > T(0))
+    {
+        header.flags |= LookupTableFileHeader::uniformFlag;
+        header.inverseSpacing = static_cast<double>(inverse);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot create lookup table file: " + path);
+    }
+
+    auto writeAt = [&file](std::uint64_t offset, const void* data, std::size_t size)
+    {
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    };
+
+    writeAt(0, &header, sizeof(header));
+    writeAt(header.inputsOffset, inputs.data(), inputs.size() * sizeof(T));
+    writeAt(header.outputsOffset, outputs.data(), outputs.size() * sizeof(T));
+    writeAt(header.slopesOffset, slopes.data(), slopes.size() * sizeof(T));
+
+    if (!file)
+    {
+        throw std::runtime_error("Cannot write lookup table file: " + path);
+    }
+}
+
+/**
+ * @brief Одномерная таблица поиска, отображённая в память из бинарного файла
+ *
+ * Размер таблицы задаётся файлом во время выполнения. Файл отображается
+ * только для чтения, поэтому все процессы, открывшие одну таблицу, используют
+ * одну копию в страничном кэше, а создание таблицы не требует разбора данных.
+ * Файл создаётся функцией writeLookupTableFile или утилитой CsvToLookupTable.
+ *
+ * @tparam T Тип значений таблицы (float или double), должен совпадать с файлом
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, typename Mutex = std::mutex>
+class MappedLookupTable1D
+{
+    static_assert(std::is_floating_point<T>::value, "Table values should be float or double");
+
+private:
+    Mutex mtx;                       //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    void* mapping = MAP_FAILED;      //!< Начало отображения файла
+    std::size_t mappingSize = 0;     //!< Размер отображения
+    detail::Lookup1DView<T> table{}; //!< Представление таблицы поверх отображённых данных
+    T output = T(0);                 //!< Значение, экстраполированное из таблицы
+
+public:
+    /**
+     * @brief Открыть и отобразить в память файл таблицы
+     *
+     * @param path Путь к файлу таблицы
+     */
+    explicit MappedLookupTable1D(const std::string& path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot open lookup table file: " + path);
+        }
+
+        struct stat status{};
+        if (fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(LookupTableFileHeader))
+        {
+            close(fd);
+            throw std::runtime_error("Lookup table file is too small: " + path);
+        }
+
+        mappingSize = static_cast<std::size_t>(status.st_size);
+        mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot map lookup table file: " + path);
+        }
+
+        try
+        {
+            table = validate(path);
+        }
+        catch (...)
+        {
+            munmap(mapping, mappingSize);
+            throw;
+        }
+    }
+
+    MappedLookupTable1D(const MappedLookupTable1D&) = delete;
+    MappedLookupTable1D& operator=(const MappedLookupTable1D&) = delete;
+
+    ~MappedLookupTable1D()
+    {
+        munmap(mapping, mappingSize);
+    }
+
+    /**
+     * @brief Интерполяция значения на основе входного значения
+     *
+     * @param inputValue Входное значение для интерполяции
+     */
+    void interpolate(const T& inputValue)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = table.evaluate(inputValue);
+    }
+
+    /**
+     * @brief Интерполяция значения с подсказкой, принадлежащей вызывающей стороне
+     *
+     * @param inputValue Входное значение для интерполяции
+     * @param segmentHint Подсказка отрезка, обновляемая при поиске
+     * @return Интерполированное значение
+     */
+    T interpolate(const T& inputValue, SegmentHint& segmentHint) const
+    {
+        return table.evaluate(inputValue, table.findSegment(inputValue, segmentHint));
+    }
+
+    /**
+     * @brief Интерполяция массива входных значений
+     *
+     * @param inputs Указатель на count входных значений
+     * @param outputs Указатель на count выходных значений
+     * @param count Количество значений
+     */
+    void interpolate(const T* inputs, T* outputs, std::size_t count) const
+    {
+        table.evaluate(inputs, outputs, count);
+    }
+
+    /**
+     * @brief Количество точек таблицы
+     */
+    std::size_t size() const
+    {
+        return table.size;
+    }
+
+    /**
+     * @brief Используется ли вычисление индекса для равномерной таблицы
+     */
+    bool isUniform() const
+    {
+        return table.uniform;
+    }
+
+    /**
+     * @brief Ссылка на текущее значение, экстраполированное из таблицы
+     */
+    const T& getOutput()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить текущий выход блока
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        output = T(0);
+    }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+    }
+
+private:
+    /**
+     * @brief Проверить заголовок файла и построить представление таблицы
+     */
+    detail::Lookup1DView<T> validate(const std::string& path) const
+    {
+        LookupTableFileHeader header;
+        std::memcpy(&header, mapping, sizeof(header));
+
+        if (std::memcmp(header.magic, LookupTableFileHeader::signature, sizeof(header.magic)) != 0 ||
+            header.version != LookupTableFileHeader::currentVersion)
+        {
+            throw std::runtime_error("Unsupported lookup table file format: " + path);
+        }
+        if (header.valueSize != sizeof(T))
+        {
+            throw std::runtime_error("Lookup table value type does not match: " + path);
+        }
+
+        // Количество и смещения проверяются до умножения и сложения, чтобы
+        // испорченный заголовок не мог переполнить вычисление границ массивов
+        const std::uint64_t size = mappingSize;
+        auto fits = [size](std::uint64_t offset, std::uint64_t length)
+        {
+            return offset <= size && length <= size - offset;
+        };
+        if (header.count < 2 ||
+            header.count > (size - sizeof(header)) / sizeof(T) ||
+            header.fileSize != size ||
+            header.inputsOffset % alignof(T) != 0 ||
+            header.outputsOffset % alignof(T) != 0 ||
+            header.slopesOffset % alignof(T) != 0 ||
+            !fits(header.inputsOffset, header.count * sizeof(T)) ||
+            !fits(header.outputsOffset, header.count * sizeof(T)) ||
+            !fits(header.slopesOffset, (header.count - 1) * sizeof(T)))
+        {
+            throw std::runtime_error("Corrupted lookup table file: " + path);
+        }
+
+        const char* base = static_cast<const char*>(mapping);
+        return {reinterpret_cast<const T*>(base + header.inputsOffset),
+                reinterpret_cast<const T*>(base + header.outputsOffset),
+                reinterpret_cast<const T*>(base + header.slopesOffset),
+                static_cast<std::size_t>(header.count),
+                (header.flags & LookupTableFileHeader::uniformFlag) != 0,
+                static_cast<T>(header.inverseSpacing)};
+    }
+};
+}
@@ -2,6 +2,7 @@
 
 #include "IntegratorBlock.hpp"
 #include "DerivativeBlock.hpp"
+#include "ThreadingPolicy.hpp"
 #include <algorithm>
 #include <mutex>
 #include <stdexcept>
@@ -13,15 +14,16 @@ namespace SimulinkBlock
  * @brief Класс, реализующий блок ПИД регулятора
  *
  * @tparam T Тип прошлого состояния и входа для блока
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex>
 class PID
 {
 private:
-    std::mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
 
-    DerivativeBlock<T> derivative; //!< Блок дифференцирования
-    IntegratorBlock<T> integrator; //!< Блок интегрирования
+    DerivativeBlock<T, NullMutex> derivative; //!< Блок дифференцирования
+    IntegratorBlock<T, NullMutex> integrator; //!< Блок интегрирования
 
     T pidOutput = T{0}; //!< Выход блока ПИД регулятора
 
@@ -67,7 +69,7 @@ public:
      */
     void setCoeffs(const T &p, const T &i, const T &d)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         P = p;
         I = i;
         D = d;
@@ -78,7 +80,7 @@ public:
      */
     void setPCoeff(const T &p)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         P = p;
     }
 
@@ -87,7 +89,7 @@ public:
      */
     void setICoeff(const T &i)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         I = i;
     }
 
@@ -96,7 +98,7 @@ public:
      */
     void setDCoeff(const T &d)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         D = d;
     }
 
@@ -110,7 +112,7 @@ public:
      */
     void setLimits(const T& minI, const T& maxI, const T& minD, const T& maxD)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         integrator.setLimits(minI, maxI);
         derivative.setLimits(minD, maxD);
     }
@@ -123,7 +125,7 @@ public:
      */
     void setIntegratorLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         integrator.setLimits(min, max);
     }
 
@@ -135,7 +137,7 @@ public:
      */
     void setDerivativeLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         derivative.setLimits(min, max);
     }
 
@@ -145,9 +147,9 @@ public:
      * @param input Входное значение
      * @param dt Временной шаг
      */
-    void step(const T& input, double dt)
+    void step(const T& input, const T& dt)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         integrator.step(input, dt);
         derivative.step(input, dt);
         pidOutput = P * input + integrator.getOutput() * I + derivative.getOutput() * D;
@@ -160,7 +162,7 @@ public:
      */
     void setDerivativeState(const T& newPrevInput)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         derivative.setState(newPrevInput);
     }
 
@@ -171,7 +173,7 @@ public:
      */
     void setIntegratorState(const T& newState)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         integrator.setState(newState);
     }
 
@@ -182,7 +184,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return pidOutput;
     }
 
@@ -191,7 +193,7 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         P = T{0};
         I = T{0};
         D = T{0};
@@ -199,5 +201,27 @@ public:
         integrator.reset();
         pidOutput = T{0};
     }
+
+    /**
+     * @brief Записать состояние регулятора в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        integrator.saveState(out);
+        derivative.saveState(out);
+        out.write(pidOutput);
+    }
+
+    /**
+     * @brief Восстановить состояние регулятора из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        integrator.restoreState(in);
+        derivative.restoreState(in);
+        in.read(pidOutput);
+    }
 };
 }
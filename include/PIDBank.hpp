@@ -0,0 +1,380 @@
+#pragma once
+
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX512F__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+
+namespace SimulinkBlock
+{
+namespace detail
+{
+/**
+ * @brief Указатели на массивы состояния банка ПИД регуляторов
+ */
+template <typename T>
+struct PIDBankLanes
+{
+    const T* P;        //!< Коэффициенты пропорциональной составляющей
+    const T* I;        //!< Коэффициенты интегрирующей составляющей
+    const T* D;        //!< Коэффициенты дифференцирующей составляющей
+    const T* minI;     //!< Минимальные пределы интегрирования
+    const T* maxI;     //!< Максимальные пределы интегрирования
+    const T* minD;     //!< Минимальные пределы дифференцирования
+    const T* maxD;     //!< Максимальные пределы дифференцирования
+    T* integrator;     //!< Состояния интеграторов
+    T* prevInput;      //!< Прошлые входы блоков дифференцирования
+    T* output;         //!< Выходы регуляторов
+};
+
+/**
+ * @brief Скалярный шаг ПИД регуляторов в диапазоне каналов [begin, end)
+ *
+ * Порядок операций совпадает с PID::step, IntegratorBlock::step и DerivativeBlock::step.
+ */
+template <typename T>
+void pidBankStepScalar(const PIDBankLanes<T>& lanes, const T* input, double dt,
+                       std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        T integral = lanes.integrator[i] + input[i] * static_cast<T>(dt);
+        integral   = std::clamp(integral, lanes.minI[i], lanes.maxI[i]);
+
+        T derivative = (input[i] - lanes.prevInput[i]) / static_cast<T>(dt);
+        derivative   = std::clamp(derivative, lanes.minD[i], lanes.maxD[i]);
+
+        lanes.integrator[i] = integral;
+        lanes.prevInput[i]  = input[i];
+        lanes.output[i]     = lanes.P[i] * input[i] + integral * lanes.I[i] + derivative * lanes.D[i];
+    }
+}
+
+/**
+ * @brief Векторный шаг ПИД регуляторов
+ *
+ * Обрабатывает каналы блоками по ширине регистра, начиная с нулевого.
+ * Умножения и сложения выполняются раздельно (без FMA), а сравнения
+ * повторяют std::clamp, поэтому результат побитово совпадает со скалярным,
+ * если скалярный код собран без FMA-сжатия (-ffp-contract=off). При
+ * -march=native компилятор может объединить умножение и сложение в PID, и
+ * результаты различаются в последнем разряде.
+ *
+ * @return Количество обработанных каналов
+ */
+template <typename T>
+std::size_t pidBankStepSimd(const PIDBankLanes<T>&, const T*, double, std::size_t)
+{
+    return 0;
+}
+
+#if defined(__AVX512F__)
+template <>
+inline std::size_t pidBankStepSimd<double>(const PIDBankLanes<double>& lanes, const double* input,
+                                           double dt, std::size_t count)
+{
+    const __m512d vdt = _mm512_set1_pd(dt);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m512d e = _mm512_loadu_pd(input + i);
+
+        __m512d integral = _mm512_add_pd(_mm512_loadu_pd(lanes.integrator + i), _mm512_mul_pd(e, vdt));
+        const __m512d minI = _mm512_loadu_pd(lanes.minI + i);
+        const __m512d maxI = _mm512_loadu_pd(lanes.maxI + i);
+        integral = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(integral, minI, _CMP_LT_OQ), integral, minI);
+        integral = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(maxI, integral, _CMP_LT_OQ), integral, maxI);
+
+        __m512d derivative = _mm512_div_pd(_mm512_sub_pd(e, _mm512_loadu_pd(lanes.prevInput + i)), vdt);
+        const __m512d minD = _mm512_loadu_pd(lanes.minD + i);
+        const __m512d maxD = _mm512_loadu_pd(lanes.maxD + i);
+        derivative = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(derivative, minD, _CMP_LT_OQ), derivative, minD);
+        derivative = _mm512_mask_blend_pd(_mm512_cmp_pd_mask(maxD, derivative, _CMP_LT_OQ), derivative, maxD);
+
+        __m512d out = _mm512_add_pd(_mm512_mul_pd(_mm512_loadu_pd(lanes.P + i), e),
+                                    _mm512_mul_pd(integral, _mm512_loadu_pd(lanes.I + i)));
+        out = _mm512_add_pd(out, _mm512_mul_pd(derivative, _mm512_loadu_pd(lanes.D + i)));
+
+        _mm512_storeu_pd(lanes.integrator + i, integral);
+        _mm512_storeu_pd(lanes.prevInput + i, e);
+        _mm512_storeu_pd(lanes.output + i, out);
+    }
+    return i;
+}
+#elif defined(__AVX__)
+template <>
+inline std::size_t pidBankStepSimd<double>(const PIDBankLanes<double>& lanes, const double* input,
+                                           double dt, std::size_t count)
+{
+    const __m256d vdt = _mm256_set1_pd(dt);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256d e = _mm256_loadu_pd(input + i);
+
+        __m256d integral = _mm256_add_pd(_mm256_loadu_pd(lanes.integrator + i), _mm256_mul_pd(e, vdt));
+        const __m256d minI = _mm256_loadu_pd(lanes.minI + i);
+        const __m256d maxI = _mm256_loadu_pd(lanes.maxI + i);
+        integral = _mm256_blendv_pd(integral, minI, _mm256_cmp_pd(integral, minI, _CMP_LT_OQ));
+        integral = _mm256_blendv_pd(integral, maxI, _mm256_cmp_pd(maxI, integral, _CMP_LT_OQ));
+
+        __m256d derivative = _mm256_div_pd(_mm256_sub_pd(e, _mm256_loadu_pd(lanes.prevInput + i)), vdt);
+        const __m256d minD = _mm256_loadu_pd(lanes.minD + i);
+        const __m256d maxD = _mm256_loadu_pd(lanes.maxD + i);
+        derivative = _mm256_blendv_pd(derivative, minD, _mm256_cmp_pd(derivative, minD, _CMP_LT_OQ));
+        derivative = _mm256_blendv_pd(derivative, maxD, _mm256_cmp_pd(maxD, derivative, _CMP_LT_OQ));
+
+        __m256d out = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(lanes.P + i), e),
+                                    _mm256_mul_pd(integral, _mm256_loadu_pd(lanes.I + i)));
+        out = _mm256_add_pd(out, _mm256_mul_pd(derivative, _mm256_loadu_pd(lanes.D + i)));
+
+        _mm256_storeu_pd(lanes.integrator + i, integral);
+        _mm256_storeu_pd(lanes.prevInput + i, e);
+        _mm256_storeu_pd(lanes.output + i, out);
+    }
+    return i;
+}
+#endif
+}
+
+/**
+ * @brief Банк независимых ПИД регуляторов, хранящий параметры и состояния в виде структуры массивов
+ *
+ * Каждый канал ведёт себя так же, как PID: интегратор и дифференциатор с пределами,
+ * выход P * e + I * ∫e + D * de/dt. Для T = double шаг выполняется инструкциями
+ * AVX-512 или AVX, если они включены при компиляции, остальные каналы и другие типы
+ * обрабатываются скалярным циклом.
+ *
+ * Результат побитово совпадает с PID, если скалярный PID собран без слияния
+ * операций в FMA (-ffp-contract=off или целевая платформа без FMA).
+ *
+ * @tparam T Тип входа и состояния регуляторов
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, typename Mutex = std::mutex>
+class PIDBank
+{
+private:
+    Mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+
+    std::vector<T> P; //!< Коэффициенты пропорциональной составляющей
+    std::vector<T> I; //!< Коэффициенты интегрирующей составляющей
+    std::vector<T> D; //!< Коэффициенты дифференцирующей составляющей
+
+    std::vector<T> integrator; //!< Состояния интеграторов
+    std::vector<T> minI;       //!< Минимальные пределы интегрирования
+    std::vector<T> maxI;       //!< Максимальные пределы интегрирования
+
+    std::vector<T> prevInput; //!< Прошлые входы блоков дифференцирования
+    std::vector<T> minD;      //!< Минимальные пределы дифференцирования
+    std::vector<T> maxD;      //!< Максимальные пределы дифференцирования
+
+    std::vector<T> output; //!< Выходы регуляторов
+
+public:
+    /**
+     * @brief Конструктор банка с одинаковыми коэффициентами для всех каналов
+     *
+     * @param lanes Количество регуляторов
+     * @param p Коэффициент усиления для пропорциональной составляющей
+     * @param i Коэффициент усиления для интегрирующей составляющей
+     * @param d Коэффициент усиления для дифференцирующей составляющей
+     */
+    explicit PIDBank(std::size_t lanes, const T& p = T{0}, const T& i = T{0}, const T& d = T{0})
+        : P(lanes, p), I(lanes, i), D(lanes, d),
+          integrator(lanes, T{0}),
+          minI(lanes, static_cast<T>(-10000)), maxI(lanes, static_cast<T>(10000)),
+          prevInput(lanes, T{0}),
+          minD(lanes, static_cast<T>(-10000)), maxD(lanes, static_cast<T>(10000)),
+          output(lanes, T{0})
+    {
+    }
+
+    /**
+     * @brief Количество регуляторов в банке
+     */
+    std::size_t size() const
+    {
+        return output.size();
+    }
+
+    /**
+     * @brief Установить коэффициенты одного регулятора
+     *
+     * @param lane Номер регулятора
+     * @param p Коэффициент усиления для пропорциональной составляющей
+     * @param i Коэффициент усиления для интегрирующей составляющей
+     * @param d Коэффициент усиления для дифференцирующей составляющей
+     */
+    void setCoeffs(std::size_t lane, const T& p, const T& i, const T& d)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        P.at(lane) = p;
+        I.at(lane) = i;
+        D.at(lane) = d;
+    }
+
+    /**
+     * @brief Установить пределы интегрирования и дифференцирования одного регулятора
+     *
+     * @param lane Номер регулятора
+     * @param minIntegral Минимальный предел интегрирования
+     * @param maxIntegral Максимальный предел интегрирования
+     * @param minDerivative Минимальный предел дифференцирования
+     * @param maxDerivative Максимальный предел дифференцирования
+     */
+    void setLimits(std::size_t lane,
+                   const T& minIntegral, const T& maxIntegral,
+                   const T& minDerivative, const T& maxDerivative)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if(minIntegral > maxIntegral || minDerivative > maxDerivative)
+        {
+            throw std::invalid_argument("Min value should not be greater than max value");
+        }
+        minI.at(lane) = minIntegral;
+        maxI.at(lane) = maxIntegral;
+        minD.at(lane) = minDerivative;
+        maxD.at(lane) = maxDerivative;
+    }
+
+    /**
+     * @brief Выполнить один шаг всех регуляторов
+     *
+     * @param inputs Указатель на size() входных значений
+     * @param dt Временной шаг
+     */
+    void step(const T* inputs, double dt)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        const detail::PIDBankLanes<T> lanes{P.data(), I.data(), D.data(),
+                                            minI.data(), maxI.data(),
+                                            minD.data(), maxD.data(),
+                                            integrator.data(), prevInput.data(), output.data()};
+
+        std::size_t done = detail::pidBankStepSimd(lanes, inputs, dt, size());
+        detail::pidBankStepScalar(lanes, inputs, dt, done, size());
+    }
+
+    /**
+     * @brief Выполнить один шаг всех регуляторов
+     *
+     * @param inputs Входные значения, размер должен совпадать с size()
+     * @param dt Временной шаг
+     */
+    void step(const std::vector<T>& inputs, double dt)
+    {
+        if (inputs.size() != size())
+        {
+            throw std::invalid_argument("Inputs size should match the number of lanes");
+        }
+        step(inputs.data(), dt);
+    }
+
+    /**
+     * @brief Установить состояние интегратора одного регулятора
+     *
+     * @param lane Номер регулятора
+     * @param newState Новое значение состояния для установки
+     */
+    void setIntegratorState(std::size_t lane, const T& newState)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        integrator.at(lane) = newState;
+    }
+
+    /**
+     * @brief Установить прошлый вход дифференциатора одного регулятора
+     *
+     * @param lane Номер регулятора
+     * @param newPrevInput Новое значение состояния для установки
+     */
+    void setDerivativeState(std::size_t lane, const T& newPrevInput)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        prevInput.at(lane) = newPrevInput;
+    }
+
+    /**
+     * @brief Получить ссылку на выход одного регулятора
+     *
+     * @param lane Номер регулятора
+     * @return Ссылка на выходные данные
+     */
+    const T& getOutput(std::size_t lane)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output.at(lane);
+    }
+
+    /**
+     * @brief Получить ссылку на выходы всех регуляторов
+     *
+     * @return Ссылка на непрерывный массив выходов
+     */
+    const std::vector<T>& getOutputs()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        return output;
+    }
+
+    /**
+     * @brief Обнулить коэффициенты и состояние одного регулятора, как PID::reset
+     *
+     * @param lane Номер регулятора
+     */
+    void reset(std::size_t lane)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        P.at(lane)          = T{0};
+        I.at(lane)          = T{0};
+        D.at(lane)          = T{0};
+        integrator.at(lane) = T{0};
+        prevInput.at(lane)  = T{0};
+        output.at(lane)     = T{0};
+    }
+
+    /**
+     * @brief Обнулить коэффициенты и состояния всех регуляторов
+     */
+    void reset()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        for (auto* lane : {&P, &I, &D, &integrator, &prevInput, &output})
+        {
+            std::fill(lane->begin(), lane->end(), T{0});
+        }
+    }
+
+    /**
+     * @brief Записать состояние всех регуляторов в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(integrator.data(), integrator.size());
+        out.write(prevInput.data(), prevInput.size());
+        out.write(output.data(), output.size());
+    }
+
+    /**
+     * @brief Восстановить состояние всех регуляторов из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(integrator.data(), integrator.size());
+        in.read(prevInput.data(), prevInput.size());
+        in.read(output.data(), output.size());
+    }
+};
+}
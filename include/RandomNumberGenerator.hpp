@@ -1,5 +1,9 @@
 #pragma once
 
+#include "Philox.hpp"
+#include "Checkpoint.hpp"
+#include "ThreadingPolicy.hpp"
+
 #include <mutex>
 #include <random>
 
@@ -9,30 +13,42 @@ namespace SimulinkBlock
  * @brief Класс для генерации случайных чисел
  *
  * @tparam T Тип генерируемого значения
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ * @tparam Engine Генератор случайных битов (std::mt19937, Philox4x32 и т.п.)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex, typename Engine = std::mt19937>
 class RandomNumberGenerator
 {
 private:
-    std::mutex mtx;         //!< Мьютекс для блокировки одновременного доступа к переменным класса
-    std::mt19937 generator; //!< Генератор случайных чисел Mersenne Twister
-    T output = T(0);        //!< Переменная для хранения сгенерированного случайного числа
+    Mutex mtx;        //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Engine generator; //!< Генератор случайных битов
+    T output = T(0);  //!< Переменная для хранения сгенерированного случайного числа
 
 public:
     /**
-     * @brief Конструктор, инициализирующий генератор случайных чисел
+     * @brief Конструктор, инициализирующий генератор случайных чисел из std::random_device
      */
     RandomNumberGenerator()
         : generator(std::random_device()())
     {
     }
 
+    /**
+     * @brief Конструктор с заданным генератором для воспроизводимых последовательностей
+     *
+     * @param engine Генератор случайных битов, например Philox4x32(seed, stream)
+     */
+    explicit RandomNumberGenerator(const Engine& engine)
+        : generator(engine)
+    {
+    }
+
     /**
      * @brief Функция для генерации случайного числа
      */
     void step()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         output = std::generate_canonical<T, 10>(generator);
     }
 
@@ -43,7 +59,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -52,8 +68,28 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         output = T(0);
     }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        detail::saveEngine(out, generator);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        detail::restoreEngine(in, generator);
+        in.read(output);
+    }
 };
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
 #include <mutex>
 #include <stdexcept>
 
@@ -10,11 +13,12 @@ namespace SimulinkBlock
   * @brief Класс, реализующий блок ограничения скорости изменения
   *
   * @tparam T Тип данных для операций ограничения
-  */
-template <typename T>
+  * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ */
+template <typename T, typename Mutex = std::mutex>
 class RateLimiter {
 private:
-    std::mutex mtx; //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx;      //!< Мьютекс для блокировки одновременного доступа к переменным класса
     T risingLimit;  //!< Предел увеличения
     T fallingLimit; //!< Предел уменьшения
     T state = T(0); //!< Текущее состояние
@@ -44,7 +48,21 @@ public:
      */
     void step(const T& input, const T& dt)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
+        process(input, dt);
+    }
+
+    /**
+     * @brief Выполнить шаг расчёта блока без блокировки мьютекса
+     *
+     * Используется при слиянии блоков в цепочку (chain).
+     *
+     * @param input Входное значение блока
+     * @param dt Временной шаг
+     * @return Новое состояние блока
+     */
+    T process(const T& input, const T& dt)
+    {
         // Скорость изменения сигнала
         T rate = input - state;
 
@@ -62,6 +80,7 @@ public:
         {
             state = input;
         }
+        return state;
     }
 
     /**
@@ -71,7 +90,7 @@ public:
      */
     void setState(const T& newState)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         state = newState;
     }
 
@@ -82,7 +101,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return state;
     }
 
@@ -91,8 +110,26 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         state = T(0);
     }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(state);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(state);
+    }
 };
 }
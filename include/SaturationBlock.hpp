@@ -1,5 +1,8 @@
 #pragma once
 
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
 #include <limits>
 #include <mutex>
 #include <stdexcept>
@@ -10,12 +13,13 @@ namespace SimulinkBlock
  * @brief Класс, реализующий логику работы блока насыщения
  *
  * @tparam T Тип входа и выхода для блока насыщения
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T>
+template <typename T, typename Mutex = std::mutex>
 class SaturationBlock
 {
 private:
-    std::mutex mtx;  //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx;       //!< Мьютекс для блокировки одновременного доступа к переменным класса
     T output = T(0); //!< Выход блока насыщения
     T minLimit;      //!< Минимальный предел насыщения
     T maxLimit;      //!< Максимальный предел насыщения
@@ -28,7 +32,7 @@ public:
      * @param minLimit Нижняя граница ограничения значения
      * @param maxLimit Верхняя граница ограничения значения
      */
-    SaturationBlock(const T& min = std::numeric_limits<T>::min(),
+    SaturationBlock(const T& min = std::numeric_limits<T>::lowest(),
                     const T& max = std::numeric_limits<T>::max())
         : minLimit{min},
           maxLimit{max}
@@ -42,13 +46,26 @@ public:
      */
     void step(const T& input)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
+        output = process(input);
+    }
+
+    /**
+     * @brief Ограничить значение без блокировки мьютекса и без записи выхода блока
+     *
+     * Используется при слиянии блоков в цепочку (chain).
+     *
+     * @param input Входное значение для блока насыщения
+     * @return Значение с учётом ограничений
+     */
+    T process(const T& input) const
+    {
         if ( input > maxLimit)
-            output = maxLimit;
+            return maxLimit;
         else if ( input < minLimit)
-            output = minLimit;
+            return minLimit;
         else
-            output = input;
+            return input;
     }
 
     /**
@@ -59,7 +76,7 @@ public:
      */
     void setLimits(const T& min, const T& max)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         if(min > max)
         {
             std::swap(maxLimit, minLimit);
@@ -77,7 +94,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -86,8 +103,26 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         output = T(0);
     }
+
+    /**
+     * @brief Записать состояние блока насыщения в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока насыщения из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+    }
 };
 }
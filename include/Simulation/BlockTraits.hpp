@@ -0,0 +1,270 @@
+#pragma once
+
+#include "../BandLimitedWhiteNoise.hpp"
+#include "../ConditionalSubsystem.hpp"
+#include "../DerivativeBlock.hpp"
+#include "../IntegratorBlock.hpp"
+#include "../LookupTable1D.hpp"
+#include "../PID.hpp"
+#include "../RandomNumberGenerator.hpp"
+#include "../RateLimiter.hpp"
+#include "../SaturationBlock.hpp"
+#include "../SineWaveGenerator.hpp"
+#include "../TriggeredSubsystem.hpp"
+#include "../WhiteNoiseGenerator.hpp"
+
+#include <cstddef>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Доступ блока модели к своим входам и выходам на текущем шаге
+ *
+ * Входы читаются напрямую из общего массива сигналов модели по индексам,
+ * вычисленным при компиляции, выходы записываются в него же.
+ *
+ * @tparam T Тип сигналов модели
+ */
+template <typename T>
+class BlockIO
+{
+private:
+    const T* signals;            //!< Массив всех сигналов модели
+    const std::size_t* sources;  //!< Индексы сигналов, подключённых ко входам блока
+    T* outputs;                  //!< Выходы блока в массиве сигналов
+    T currentTime;               //!< Время текущего шага
+    T stepSize;                  //!< Шаг моделирования
+
+public:
+    BlockIO(const T* signalArray, const std::size_t* inputSources, T* outputArray, T time, T dt)
+        : signals{signalArray}, sources{inputSources}, outputs{outputArray}, currentTime{time}, stepSize{dt}
+    {
+    }
+
+    /**
+     * @brief Значение входа с номером index
+     */
+    const T& input(std::size_t index) const
+    {
+        return signals[sources[index]];
+    }
+
+    /**
+     * @brief Ссылка на выход с номером index
+     */
+    T& output(std::size_t index) const
+    {
+        return outputs[index];
+    }
+
+    /**
+     * @brief Время текущего шага
+     */
+    T time() const
+    {
+        return currentTime;
+    }
+
+    /**
+     * @brief Шаг моделирования
+     */
+    T dt() const
+    {
+        return stepSize;
+    }
+};
+
+/**
+ * @brief Описание блока библиотеки для Model::add
+ *
+ * Специализация должна задать количество входов и выходов, признак прямой
+ * связи входа с выходом на том же шаге (directFeedthrough) и статическую
+ * функцию output, выполняющую шаг блока. Блок без прямой связи может задать
+ * функцию update, которая вызывается после вычисления выходов всех блоков.
+ *
+ * @tparam Block Тип блока
+ */
+template <typename Block>
+struct ModelBlockTraits;
+
+template <typename T, typename Mutex>
+struct ModelBlockTraits<IntegratorBlock<T, Mutex>>
+{
+    static constexpr std::size_t inputs = 1;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(IntegratorBlock<T, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)), static_cast<T>(io.dt()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex>
+struct ModelBlockTraits<DerivativeBlock<T, Mutex>>
+{
+    static constexpr std::size_t inputs = 1;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(DerivativeBlock<T, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)), static_cast<T>(io.dt()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex>
+struct ModelBlockTraits<SaturationBlock<T, Mutex>>
+{
+    static constexpr std::size_t inputs = 1;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(SaturationBlock<T, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex>
+struct ModelBlockTraits<RateLimiter<T, Mutex>>
+{
+    static constexpr std::size_t inputs = 1;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(RateLimiter<T, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)), static_cast<T>(io.dt()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex>
+struct ModelBlockTraits<PID<T, Mutex>>
+{
+    static constexpr std::size_t inputs = 1;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(PID<T, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)), static_cast<T>(io.dt()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, std::size_t N, typename Mutex>
+struct ModelBlockTraits<LookupTable1D<T, N, Mutex>>
+{
+    static constexpr std::size_t inputs = 1;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(LookupTable1D<T, N, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.interpolate(static_cast<T>(io.input(0)));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename U, typename Mutex>
+struct ModelBlockTraits<TriggeredSubsystem<T, U, Mutex>>
+{
+    static constexpr std::size_t inputs = 2; //!< Вход и триггер
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(TriggeredSubsystem<T, U, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)), static_cast<U>(io.input(1)));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename U, typename Mutex>
+struct ModelBlockTraits<ConditionalSubsystem<T, U, Mutex>>
+{
+    static constexpr std::size_t inputs = 2; //!< Вход и управляющий сигнал
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = true;
+
+    template <typename S>
+    static void output(ConditionalSubsystem<T, U, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.input(0)), static_cast<U>(io.input(1)), static_cast<T>(io.dt()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename U, typename Mutex>
+struct ModelBlockTraits<SineWaveGenerator<T, U, Mutex>>
+{
+    static constexpr std::size_t inputs = 0;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = false;
+
+    template <typename S>
+    static void output(SineWaveGenerator<T, U, Mutex>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<U>(io.time()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex, typename Engine>
+struct ModelBlockTraits<WhiteNoiseGenerator<T, Mutex, Engine>>
+{
+    static constexpr std::size_t inputs = 0;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = false;
+
+    template <typename S>
+    static void output(WhiteNoiseGenerator<T, Mutex, Engine>& block, const BlockIO<S>& io)
+    {
+        block.step();
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex, typename Engine>
+struct ModelBlockTraits<BandLimitedWhiteNoise<T, Mutex, Engine>>
+{
+    static constexpr std::size_t inputs = 0;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = false;
+
+    template <typename S>
+    static void output(BandLimitedWhiteNoise<T, Mutex, Engine>& block, const BlockIO<S>& io)
+    {
+        block.step(static_cast<T>(io.time()));
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+
+template <typename T, typename Mutex, typename Engine>
+struct ModelBlockTraits<RandomNumberGenerator<T, Mutex, Engine>>
+{
+    static constexpr std::size_t inputs = 0;
+    static constexpr std::size_t outputs = 1;
+    static constexpr bool directFeedthrough = false;
+
+    template <typename S>
+    static void output(RandomNumberGenerator<T, Mutex, Engine>& block, const BlockIO<S>& io)
+    {
+        block.step();
+        io.output(0) = static_cast<S>(block.getOutput());
+    }
+};
+}
@@ -0,0 +1,459 @@
+#pragma once
+
+#include "EventQueue.hpp"
+#include "OdeSolver.hpp"
+#include "ZeroCrossing.hpp"
+#include "../IntegratorBlock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Модель с непрерывными состояниями, интегрируемыми общим решателем
+ *
+ * Состояниями служат блоки IntegratorBlock (или собственные состояния модели).
+ * Вместо того чтобы каждый блок интегрировал свой вход методом Эйлера,
+ * функция derivatives вычисляет входы всех интеграторов по текущим состояниям,
+ * а решатель (RK4, метод трапеций или Дорман-Принс) продвигает все состояния
+ * одновременно. После каждого принятого шага состояния ограничиваются
+ * пределами интеграторов и записываются в блоки, поэтому getOutput() блоков
+ * возвращает актуальные значения.
+ *
+ * Функция derivatives вызывается на промежуточных стадиях шага и не должна
+ * изменять состояние блоков с дискретной памятью (PID, DerivativeBlock).
+ *
+ * События: функции пересечения нуля g(t, x) проверяются в конце каждого
+ * принятого шага решателя (у DormandPrince их может быть несколько за один
+ * advance()). При смене знака решатель останавливается, момент пересечения
+ * уточняется методом Иллинойс по кубической эрмитовой интерполяции
+ * состояний внутри этого шага, после чего модель интегрируется ровно до
+ * этого момента, выполняет действие события и продолжает интегрирование.
+ * Два пересечения одной функции внутри одного шага решателя не различаются,
+ * поэтому шаг (для DormandPrince - maxStep) должен быть меньше интервала
+ * между событиями. События по времени хранятся в очереди
+ * модели, и интегрирование останавливается точно в их моменты. Поэтому шаг
+ * advance() может быть крупным, а события - например, переключения
+ * триггерных подсистем - происходят в точные моменты внутри шага.
+ *
+ * @tparam T Тип состояний
+ */
+template <typename T = double>
+class ContinuousModel
+{
+public:
+    using Derivatives = std::function<void(T time, const T* states, T* derivatives)>; //!< Функция производных
+    using CrossingFunction = std::function<T(T time, const T* states)>;                //!< Функция пересечения нуля
+    using EventAction = std::function<void(T time, T* states)>;                        //!< Действие события
+
+private:
+    SolverOptions options;                                //!< Параметры решателя
+    std::unique_ptr<OdeSolver<T>> solver;                 //!< Решатель, создаётся при первом шаге
+    std::vector<T> states;                                //!< Непрерывные состояния
+    std::vector<std::function<T()>> readBack;             //!< Чтение состояний из блоков
+    std::vector<std::function<T(const T&)>> writeBack;    //!< Запись состояний в блоки с учётом пределов
+    Derivatives derivatives;                              //!< Функция производных
+    T currentTime;                                        //!< Текущее время
+
+    /**
+     * @brief Функция пересечения нуля с действием
+     */
+    struct ZeroCrossing
+    {
+        CrossingFunction function;  //!< Функция g(t, x)
+        CrossingDirection direction; //!< Направление пересечения
+        EventAction action;         //!< Действие в момент пересечения
+    };
+
+    std::vector<ZeroCrossing> crossings;                  //!< Функции пересечения нуля
+    std::vector<T> crossingValues;                        //!< Значения функций в текущий момент
+    std::vector<T> endValues;                             //!< Значения функций в конце шага
+    bool crossingValuesValid = false;                     //!< Актуальны ли значения функций
+    EventQueue<T, EventAction> events;                    //!< События по времени
+    T eventTolerance = T(1e-10);                          //!< Точность момента пересечения
+    std::size_t crossingCount = 0;                        //!< Количество обработанных пересечений
+    T stepStartTime = T(0);                               //!< Начало последнего принятого шага
+    T stepEndTime = T(0);                                 //!< Конец шага, в котором найдено пересечение
+    std::vector<T> startStates;                           //!< Состояния в начале шага
+    std::vector<T> startDerivatives;                      //!< Производные в начале шага
+    std::vector<T> endDerivatives;                        //!< Производные в конце шага
+    std::vector<T> interpolated;                          //!< Интерполированные состояния
+
+public:
+    /**
+     * @brief Конструктор модели
+     *
+     * @param solverOptions Параметры решателя
+     * @param t0 Начальное время
+     */
+    explicit ContinuousModel(SolverOptions solverOptions = {}, T t0 = T(0))
+        : options{solverOptions}, currentTime{t0}
+    {
+    }
+
+    /**
+     * @brief Сделать состояние блока интегрирования непрерывным состоянием модели
+     *
+     * @param block Блок, который должен существовать, пока существует модель
+     * @return Номер состояния
+     */
+    template <typename Mutex>
+    std::size_t addState(IntegratorBlock<T, Mutex>& block)
+    {
+        states.push_back(block.getOutput());
+        readBack.push_back([&block] { return block.getOutput(); });
+        writeBack.push_back([&block](const T& value) { return block.setClampedState(value); });
+        solver.reset();
+        crossingValuesValid = false;
+        return states.size() - 1;
+    }
+
+    /**
+     * @brief Добавить непрерывное состояние без блока
+     *
+     * @param initial Начальное значение
+     * @return Номер состояния
+     */
+    std::size_t addState(T initial)
+    {
+        states.push_back(initial);
+        readBack.push_back(nullptr);
+        writeBack.push_back([](const T& value) { return value; });
+        solver.reset();
+        crossingValuesValid = false;
+        return states.size() - 1;
+    }
+
+    /**
+     * @brief Задать функцию производных
+     *
+     * @param function Функция f(t, x, dx), записывающая вход каждого интегратора в dx
+     */
+    void setDerivatives(Derivatives function)
+    {
+        derivatives = std::move(function);
+    }
+
+    /**
+     * @brief Добавить функцию пересечения нуля
+     *
+     * Действие получает момент пересечения и может изменить состояния
+     * (например, скорость при отскоке) или выполнить триггерные блоки.
+     * Изменённые состояния ограничиваются пределами интеграторов.
+     *
+     * @param function Функция g(t, x), событие происходит при смене её знака
+     * @param direction Направление пересечения
+     * @param action Действие
+     * @return Номер функции
+     */
+    std::size_t addZeroCrossing(CrossingFunction function, CrossingDirection direction, EventAction action)
+    {
+        if (!function || !action)
+        {
+            throw std::invalid_argument("Zero crossing function and action should be set");
+        }
+        crossings.push_back(ZeroCrossing{std::move(function), direction, std::move(action)});
+        crossingValuesValid = false;
+        return crossings.size() - 1;
+    }
+
+    /**
+     * @brief Запланировать событие на момент time
+     *
+     * Событие с моментом в прошлом выполняется в начале следующего advance().
+     *
+     * @param time Момент события
+     * @param action Действие
+     */
+    void schedule(T time, EventAction action)
+    {
+        if (!action)
+        {
+            throw std::invalid_argument("Event action should be set");
+        }
+        events.schedule(time, std::move(action));
+    }
+
+    /**
+     * @brief Задать точность определения момента пересечения нуля
+     */
+    void setEventTolerance(T tolerance)
+    {
+        if (!(tolerance > T(0)))
+        {
+            throw std::invalid_argument("Event tolerance should be positive");
+        }
+        eventTolerance = tolerance;
+    }
+
+    /**
+     * @brief Продвинуть модель на интервал duration
+     *
+     * Методы с фиксированным шагом делают один шаг длины duration,
+     * DormandPrince - столько шагов, сколько требует точность. Интервал
+     * разбивается на части моментами событий и пересечений нуля. Состояния
+     * блоков, изменённые между вызовами (setState, reset), учитываются.
+     */
+    void advance(T duration)
+    {
+        if (!derivatives)
+        {
+            throw std::logic_error("Derivatives function should be set before advancing");
+        }
+        if (!(duration > T(0)))
+        {
+            throw std::invalid_argument("Integration interval should be positive");
+        }
+        if (!solver)
+        {
+            solver = std::make_unique<OdeSolver<T>>(states.size(), options);
+        }
+        for (std::size_t i = 0; i < states.size(); ++i)
+        {
+            if (readBack[i])
+            {
+                const T value = readBack[i]();
+                crossingValuesValid = crossingValuesValid && value == states[i];
+                states[i] = value;
+            }
+        }
+
+        const T end = currentTime + duration;
+        while (true)
+        {
+            if (events.nextTime() <= currentTime)
+            {
+                auto event = events.pop();
+                fire(event.action);
+                continue;
+            }
+            if (!(currentTime < end))
+            {
+                break;
+            }
+            integrateTo(std::min(end, events.nextTime()));
+        }
+    }
+
+    /**
+     * @brief Значение состояния с номером index
+     */
+    const T& state(std::size_t index) const
+    {
+        return states.at(index);
+    }
+
+    /**
+     * @brief Текущее время
+     */
+    T time() const
+    {
+        return currentTime;
+    }
+
+    /**
+     * @brief Счётчики работы решателя
+     */
+    SolverStatistics statistics() const
+    {
+        return solver ? solver->statistics() : SolverStatistics{};
+    }
+
+    /**
+     * @brief Количество обработанных пересечений нуля
+     */
+    std::size_t zeroCrossings() const
+    {
+        return crossingCount;
+    }
+
+    /**
+     * @brief Количество запланированных событий по времени
+     */
+    std::size_t pendingEvents() const
+    {
+        return events.size();
+    }
+
+private:
+    /**
+     * @brief Проинтегрировать состояния от текущего момента на duration
+     *
+     * Если заданы функции пересечения нуля и detect равен true, после каждого
+     * принятого шага решателя проверяется смена их знака; при пересечении
+     * интегрирование останавливается в конце этого шага, а его начало и
+     * конец сохраняются для уточнения момента события.
+     *
+     * @return Было ли найдено пересечение
+     */
+    bool integrate(T duration, bool detect)
+    {
+        T time = currentTime;
+        stepStartTime = currentTime;
+        if (detect)
+        {
+            startStates = states;
+        }
+        bool crossed = false;
+        solver->advance(derivatives, time, states.data(), duration, [this, detect, &crossed](T t, T* x)
+        {
+            bool changed = false;
+            for (std::size_t i = 0; i < states.size(); ++i)
+            {
+                const T limited = writeBack[i](x[i]);
+                changed = changed || limited != x[i];
+                x[i] = limited;
+            }
+            if (!detect)
+            {
+                return changed;
+            }
+
+            evaluateCrossings(t, x, endValues);
+            for (std::size_t j = 0; j < crossings.size(); ++j)
+            {
+                if (detail::crossesZero(crossingValues[j], endValues[j], crossings[j].direction))
+                {
+                    crossed     = true;
+                    stepEndTime = t;
+                    solver->interrupt();
+                    return changed;
+                }
+            }
+            std::swap(crossingValues, endValues);
+            std::copy(x, x + states.size(), startStates.begin());
+            stepStartTime = t;
+            return changed;
+        });
+        currentTime = time;
+        return crossed;
+    }
+
+    /**
+     * @brief Выполнить действие события и записать изменённые состояния в блоки
+     */
+    void fire(const EventAction& action)
+    {
+        action(currentTime, states.data());
+        for (std::size_t i = 0; i < states.size(); ++i)
+        {
+            states[i] = writeBack[i](states[i]);
+        }
+        crossingValuesValid = false;
+    }
+
+    /**
+     * @brief Значения функций пересечения нуля в момент time для состояний x
+     */
+    void evaluateCrossings(T time, const T* x, std::vector<T>& values) const
+    {
+        values.resize(crossings.size());
+        for (std::size_t j = 0; j < crossings.size(); ++j)
+        {
+            values[j] = crossings[j].function(time, x);
+        }
+    }
+
+    /**
+     * @brief Проинтегрировать до момента stop с обработкой пересечений нуля
+     */
+    void integrateTo(T stop)
+    {
+        if (crossings.empty())
+        {
+            integrate(stop - currentTime, false);
+            currentTime = stop;
+            return;
+        }
+        if (!crossingValuesValid)
+        {
+            evaluateCrossings(currentTime, states.data(), crossingValues);
+            crossingValuesValid = true;
+        }
+
+        while (currentTime < stop)
+        {
+            if (!integrate(stop - currentTime, true))
+            {
+                currentTime = stop;
+                return;
+            }
+
+            // Шаг решателя [start, end], в котором сменился знак; states - состояния в его конце
+            const T start = stepStartTime;
+            const T end   = stepEndTime;
+            const T h     = end - start;
+            startDerivatives.resize(states.size());
+            endDerivatives.resize(states.size());
+            interpolated.resize(states.size());
+            derivatives(start, startStates.data(), startDerivatives.data());
+            derivatives(end, states.data(), endDerivatives.data());
+
+            // Эрмитова интерполяция состояний по значениям и производным на концах шага
+            auto crossingAt = [&](std::size_t j, T time)
+            {
+                const T s  = (time - start) / h;
+                const T s2 = s * s, s3 = s2 * s;
+                const T h00 = 2 * s3 - 3 * s2 + 1, h10 = s3 - 2 * s2 + s;
+                const T h01 = -2 * s3 + 3 * s2,    h11 = s3 - s2;
+                for (std::size_t i = 0; i < states.size(); ++i)
+                {
+                    interpolated[i] = h00 * startStates[i] + h10 * h * startDerivatives[i]
+                                    + h01 * states[i] + h11 * h * endDerivatives[i];
+                }
+                return crossings[j].function(time, interpolated.data());
+            };
+
+            // Самое раннее пересечение среди всех функций
+            std::size_t first = crossings.size();
+            T eventTime = end;
+            for (std::size_t j = 0; j < crossings.size(); ++j)
+            {
+                if (!detail::crossesZero(crossingValues[j], endValues[j], crossings[j].direction))
+                {
+                    continue;
+                }
+                const T located = detail::locateZeroCrossing([&](T time) { return crossingAt(j, time); },
+                                                             start, crossingValues[j], end, endValues[j],
+                                                             eventTolerance);
+                if (first == crossings.size() || located < eventTime)
+                {
+                    eventTime = located;
+                    first     = j;
+                }
+            }
+
+            states      = startStates;
+            currentTime = start;
+            if (eventTime > start)
+            {
+                integrate(eventTime - start, false);
+            }
+            currentTime = eventTime;
+            ++crossingCount;
+            fire(crossings[first].action);
+
+            // Сработавшая функция находится в нуле, её знак определяется чуть позже события:
+            // после отскока - по новой скорости, при проходе через ноль - по прежней
+            evaluateCrossings(currentTime, states.data(), crossingValues);
+            derivatives(currentTime, states.data(), startDerivatives.data());
+            const T delta = std::max(eventTolerance, std::sqrt(std::numeric_limits<T>::epsilon())
+                                                     * std::max(T(1), std::fabs(currentTime)));
+            for (std::size_t i = 0; i < states.size(); ++i)
+            {
+                interpolated[i] = states[i] + delta * startDerivatives[i];
+            }
+            crossingValues[first] = crossings[first].function(currentTime + delta, interpolated.data());
+            crossingValuesValid   = true;
+        }
+    }
+};
+}
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Очередь событий модели, упорядоченная по времени
+ *
+ * Событие - время и действие. События с одинаковым временем выполняются в
+ * порядке добавления. Очередь хранится двоичной кучей в непрерывном массиве,
+ * поэтому добавление и извлечение стоят O(log n), а после reserve() не
+ * выделяют память.
+ *
+ * @tparam T Тип времени
+ * @tparam Action Действие события
+ */
+template <typename T = double, typename Action = std::function<void(T time)>>
+class EventQueue
+{
+public:
+    /**
+     * @brief Запланированное событие
+     */
+    struct Event
+    {
+        T time;                 //!< Время события
+        unsigned long long id;  //!< Порядковый номер добавления
+        Action action;          //!< Действие
+    };
+
+private:
+    std::vector<Event> heap;           //!< Куча событий, ближайшее - в начале
+    unsigned long long nextId = 0;     //!< Номер следующего события
+
+    /**
+     * @brief Сравнение для кучи: событие a выполняется позже b
+     */
+    static bool later(const Event& a, const Event& b)
+    {
+        return a.time > b.time || (a.time == b.time && a.id > b.id);
+    }
+
+public:
+    /**
+     * @brief Зарезервировать место для count событий
+     */
+    void reserve(std::size_t count)
+    {
+        heap.reserve(count);
+    }
+
+    /**
+     * @brief Запланировать событие
+     *
+     * @param time Время события
+     * @param action Действие
+     */
+    void schedule(T time, Action action)
+    {
+        if (time != time)
+        {
+            throw std::invalid_argument("Event time should be a number");
+        }
+        heap.push_back(Event{time, nextId++, std::move(action)});
+        std::push_heap(heap.begin(), heap.end(), later);
+    }
+
+    /**
+     * @brief Есть ли запланированные события
+     */
+    bool empty() const
+    {
+        return heap.empty();
+    }
+
+    /**
+     * @brief Количество запланированных событий
+     */
+    std::size_t size() const
+    {
+        return heap.size();
+    }
+
+    /**
+     * @brief Время ближайшего события, бесконечность при пустой очереди
+     */
+    T nextTime() const
+    {
+        return heap.empty() ? std::numeric_limits<T>::infinity() : heap.front().time;
+    }
+
+    /**
+     * @brief Извлечь ближайшее событие
+     */
+    Event pop()
+    {
+        if (heap.empty())
+        {
+            throw std::logic_error("Event queue is empty");
+        }
+        std::pop_heap(heap.begin(), heap.end(), later);
+        Event event = std::move(heap.back());
+        heap.pop_back();
+        return event;
+    }
+
+    /**
+     * @brief Выполнить все события со временем не больше time
+     *
+     * Действие вызывается с временем события и может планировать новые
+     * события; попадающие в интервал выполняются в том же вызове.
+     *
+     * @return Количество выполненных событий
+     */
+    std::size_t runUntil(T time)
+    {
+        std::size_t count = 0;
+        while (!heap.empty() && heap.front().time <= time)
+        {
+            Event event = pop();
+            event.action(event.time);
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Удалить все события
+     */
+    void clear()
+    {
+        heap.clear();
+    }
+};
+}
@@ -0,0 +1,525 @@
+#pragma once
+
+#include "BlockTraits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+namespace detail
+{
+/**
+ * @brief Признак наличия функции update в описании блока
+ */
+template <typename Traits, typename Block, typename T, typename = void>
+struct HasModelUpdate : std::false_type
+{
+};
+
+template <typename Traits, typename Block, typename T>
+struct HasModelUpdate<Traits, Block, T,
+                      decltype(Traits::update(std::declval<Block&>(), std::declval<const BlockIO<T>&>()))>
+    : std::true_type
+{
+};
+}
+
+/**
+ * @brief Модель из блоков, соединённых сигналами, с вычислением порядка выполнения
+ *
+ * Блоки регистрируются как узлы с пронумерованными входами и выходами,
+ * соединения задаются один раз. compile() упорядочивает блоки топологически
+ * по связям, ведущим во входы с прямой связью (directFeedthrough), и находит
+ * алгебраические петли - циклы, не разорванные блоком без прямой связи
+ * (например, UnitDelay). Результат компиляции - плоское расписание и
+ * непрерывный массив сигналов, поэтому step() не выделяет память, не ищет
+ * блоки и не копирует выходы через промежуточные переменные.
+ *
+ * Шаг состоит из двух фаз: вычисление выходов всех блоков в порядке
+ * расписания, затем обновление состояний блоков без прямой связи.
+ *
+ * Блоки библиотеки, переданные в add(), не копируются: модель хранит ссылки,
+ * и блоки должны существовать, пока существует модель. Модель не
+ * синхронизирует доступ сама, поэтому блокам достаточно политики NullMutex.
+ *
+ * @tparam T Тип сигналов модели
+ */
+template <typename T = double>
+class Model
+{
+public:
+    using OutputFunction = void (*)(void* object, const BlockIO<T>& io); //!< Функция фазы выходов или обновления
+
+    /**
+     * @brief Выход блока
+     */
+    struct OutputPort
+    {
+        std::size_t block; //!< Номер блока
+        std::size_t index; //!< Номер выхода
+    };
+
+    /**
+     * @brief Вход блока
+     */
+    struct InputPort
+    {
+        std::size_t block; //!< Номер блока
+        std::size_t index; //!< Номер входа
+    };
+
+    /**
+     * @brief Дескриптор блока, зарегистрированного в модели
+     */
+    struct BlockHandle
+    {
+        std::size_t id; //!< Номер блока
+
+        /**
+         * @brief Выход блока с номером index
+         */
+        OutputPort out(std::size_t index = 0) const
+        {
+            return {id, index};
+        }
+
+        /**
+         * @brief Вход блока с номером index
+         */
+        InputPort in(std::size_t index = 0) const
+        {
+            return {id, index};
+        }
+    };
+
+private:
+    static constexpr std::size_t unconnected = static_cast<std::size_t>(-1); //!< Признак неподключённого входа
+
+    /**
+     * @brief Узел модели
+     */
+    struct Node
+    {
+        std::string name;             //!< Имя блока для сообщений об ошибках
+        std::size_t inputs;           //!< Количество входов
+        std::size_t outputs;          //!< Количество выходов
+        bool directFeedthrough;       //!< Зависят ли выходы от входов того же шага
+        void* object;                 //!< Блок или функция, выполняющая шаг
+        OutputFunction output;        //!< Функция фазы выходов
+        OutputFunction update;        //!< Функция фазы обновления (может отсутствовать)
+        std::size_t firstInput;       //!< Смещение входов в массиве inputSources
+        std::size_t firstOutput;      //!< Смещение выходов в массиве сигналов
+    };
+
+    /**
+     * @brief Элемент расписания
+     */
+    struct Task
+    {
+        void* object;                //!< Блок или функция, выполняющая шаг
+        OutputFunction function;     //!< Выполняемая функция
+        const std::size_t* sources;  //!< Индексы сигналов входов
+        T* outputs;                  //!< Выходы в массиве сигналов
+    };
+
+    T stepSize;                                    //!< Шаг моделирования
+    T startTime = T(0);                            //!< Время первого шага
+    unsigned long long stepCount = 0;              //!< Количество выполненных шагов
+    std::vector<Node> nodes;                       //!< Зарегистрированные блоки
+    std::vector<std::size_t> inputSources;         //!< Индекс сигнала для каждого входа каждого блока
+    std::vector<T> signals;                        //!< Значения всех выходов всех блоков
+    std::vector<std::size_t> order;                //!< Порядок выполнения блоков
+    std::vector<Task> outputSchedule;              //!< Расписание фазы выходов
+    std::vector<Task> updateSchedule;              //!< Расписание фазы обновления
+    std::vector<std::shared_ptr<void>> owned;      //!< Объекты, принадлежащие модели
+    std::vector<std::size_t> inports;              //!< Номера внешних входов
+    bool compiled = false;                         //!< Актуально ли расписание
+
+public:
+    /**
+     * @brief Конструктор модели
+     *
+     * @param dt Шаг моделирования
+     * @param t0 Время первого шага
+     */
+    explicit Model(T dt, T t0 = T(0))
+        : stepSize{dt}, startTime{t0}
+    {
+        if (!(dt > T(0)))
+        {
+            throw std::invalid_argument("Step size should be positive");
+        }
+    }
+
+    // Расписание указывает на массивы модели, поэтому модель перемещается, но не копируется
+    Model(const Model&) = delete;
+    Model& operator=(const Model&) = delete;
+    Model(Model&&) = default;
+    Model& operator=(Model&&) = default;
+
+    /**
+     * @brief Зарегистрировать блок библиотеки, описанный ModelBlockTraits
+     *
+     * @param block Блок, который должен существовать, пока существует модель
+     * @param name Имя блока для сообщений об ошибках
+     * @return Дескриптор блока
+     */
+    template <typename Block>
+    BlockHandle add(Block& block, std::string name = {})
+    {
+        using Traits = ModelBlockTraits<Block>;
+
+        OutputFunction update = nullptr;
+        if constexpr (detail::HasModelUpdate<Traits, Block, T>::value)
+        {
+            update = [](void* object, const BlockIO<T>& io)
+            {
+                Traits::update(*static_cast<Block*>(object), io);
+            };
+        }
+
+        return addNode(std::move(name), Traits::inputs, Traits::outputs, Traits::directFeedthrough,
+                       &block,
+                       [](void* object, const BlockIO<T>& io)
+                       {
+                           Traits::output(*static_cast<Block*>(object), io);
+                       },
+                       update);
+    }
+
+    /**
+     * @brief Зарегистрировать блок, заданный функциями
+     *
+     * @param name Имя блока
+     * @param inputs Количество входов
+     * @param outputs Количество выходов
+     * @param directFeedthrough Зависят ли выходы от входов того же шага
+     * @param output Функция фазы выходов
+     * @param update Функция фазы обновления (необязательна)
+     * @return Дескриптор блока
+     */
+    BlockHandle addFunction(std::string name,
+                            std::size_t inputs,
+                            std::size_t outputs,
+                            bool directFeedthrough,
+                            std::function<void(const BlockIO<T>&)> output,
+                            std::function<void(const BlockIO<T>&)> update = {})
+    {
+        using Functions = std::pair<std::function<void(const BlockIO<T>&)>, std::function<void(const BlockIO<T>&)>>;
+
+        if (!output)
+        {
+            throw std::invalid_argument("Output function should be set");
+        }
+
+        const bool hasUpdate = static_cast<bool>(update);
+        auto functions = std::make_shared<Functions>(std::move(output), std::move(update));
+        owned.push_back(functions);
+
+        return addNode(std::move(name), inputs, outputs, directFeedthrough, functions.get(),
+                       [](void* object, const BlockIO<T>& io)
+                       {
+                           static_cast<Functions*>(object)->first(io);
+                       },
+                       hasUpdate ? [](void* object, const BlockIO<T>& io)
+                                   {
+                                       static_cast<Functions*>(object)->second(io);
+                                   }
+                                 : OutputFunction{nullptr});
+    }
+
+    /**
+     * @brief Зарегистрировать блок постоянного значения
+     *
+     * @param value Значение
+     * @param name Имя блока
+     * @return Дескриптор блока
+     */
+    BlockHandle addConstant(T value, std::string name = "Constant")
+    {
+        auto storage = std::make_shared<T>(value);
+        owned.push_back(storage);
+        return addNode(std::move(name), 0, 1, false, storage.get(),
+                       [](void* object, const BlockIO<T>& io)
+                       {
+                           io.output(0) = *static_cast<T*>(object);
+                       },
+                       nullptr);
+    }
+
+    /**
+     * @brief Зарегистрировать внешний вход модели, значение задаётся setInput()
+     *
+     * @param name Имя входа
+     * @return Дескриптор блока
+     */
+    BlockHandle addInport(std::string name = "Inport")
+    {
+        const BlockHandle handle = addConstant(T(0), std::move(name));
+        inports.push_back(handle.id);
+        return handle;
+    }
+
+    /**
+     * @brief Зарегистрировать блок задержки на один шаг (Unit Delay)
+     *
+     * Выход равен входу предыдущего шага, поэтому блок разрывает петли.
+     *
+     * @param initial Выход на первом шаге
+     * @param name Имя блока
+     * @return Дескриптор блока
+     */
+    BlockHandle addUnitDelay(T initial = T(0), std::string name = "UnitDelay")
+    {
+        auto state = std::make_shared<T>(initial);
+        owned.push_back(state);
+        return addNode(std::move(name), 1, 1, false, state.get(),
+                       [](void* object, const BlockIO<T>& io)
+                       {
+                           io.output(0) = *static_cast<T*>(object);
+                       },
+                       [](void* object, const BlockIO<T>& io)
+                       {
+                           *static_cast<T*>(object) = io.input(0);
+                       });
+    }
+
+    /**
+     * @brief Соединить выход одного блока со входом другого
+     *
+     * @param from Выход блока-источника
+     * @param to Вход блока-приёмника
+     */
+    void connect(OutputPort from, InputPort to)
+    {
+        if (from.block >= nodes.size() || from.index >= nodes[from.block].outputs)
+        {
+            throw std::invalid_argument("Output port does not exist");
+        }
+        if (to.block >= nodes.size() || to.index >= nodes[to.block].inputs)
+        {
+            throw std::invalid_argument("Input port does not exist");
+        }
+
+        std::size_t& source = inputSources[nodes[to.block].firstInput + to.index];
+        if (source != unconnected)
+        {
+            throw std::invalid_argument("Input of block " + nodes[to.block].name + " is already connected");
+        }
+        source   = nodes[from.block].firstOutput + from.index;
+        compiled = false;
+    }
+
+    /**
+     * @brief Упорядочить блоки и построить расписание
+     *
+     * Выбрасывает std::invalid_argument при неподключённом входе
+     * или алгебраической петле.
+     */
+    void compile()
+    {
+        for (const Node& node : nodes)
+        {
+            for (std::size_t i = 0; i < node.inputs; ++i)
+            {
+                if (inputSources[node.firstInput + i] == unconnected)
+                {
+                    throw std::invalid_argument("Input " + std::to_string(i) + " of block " + node.name + " is not connected");
+                }
+            }
+        }
+
+        // Владелец каждого сигнала
+        std::vector<std::size_t> signalOwner;
+        for (std::size_t id = 0; id < nodes.size(); ++id)
+        {
+            signalOwner.insert(signalOwner.end(), nodes[id].outputs, id);
+        }
+
+        // Алгоритм Кана: ребро источник -> приёмник есть только для приёмников с прямой связью
+        std::vector<std::vector<std::size_t>> successors(nodes.size());
+        std::vector<std::size_t> inDegree(nodes.size(), 0);
+        for (std::size_t id = 0; id < nodes.size(); ++id)
+        {
+            if (!nodes[id].directFeedthrough)
+            {
+                continue;
+            }
+            for (std::size_t i = 0; i < nodes[id].inputs; ++i)
+            {
+                successors[signalOwner[inputSources[nodes[id].firstInput + i]]].push_back(id);
+                ++inDegree[id];
+            }
+        }
+
+        std::deque<std::size_t> ready;
+        for (std::size_t id = 0; id < nodes.size(); ++id)
+        {
+            if (inDegree[id] == 0)
+            {
+                ready.push_back(id);
+            }
+        }
+
+        std::vector<std::size_t> sorted;
+        sorted.reserve(nodes.size());
+        while (!ready.empty())
+        {
+            const std::size_t id = ready.front();
+            ready.pop_front();
+            sorted.push_back(id);
+            for (std::size_t next : successors[id])
+            {
+                if (--inDegree[next] == 0)
+                {
+                    ready.push_back(next);
+                }
+            }
+        }
+
+        if (sorted.size() != nodes.size())
+        {
+            std::string blocks;
+            for (std::size_t id = 0; id < nodes.size(); ++id)
+            {
+                if (inDegree[id] != 0)
+                {
+                    blocks += (blocks.empty() ? "" : ", ") + nodes[id].name;
+                }
+            }
+            throw std::invalid_argument("Algebraic loop between blocks: " + blocks);
+        }
+
+        signals.assign(signalOwner.size(), T(0));
+        order = std::move(sorted);
+        outputSchedule.clear();
+        updateSchedule.clear();
+        for (std::size_t id : order)
+        {
+            const Node& node = nodes[id];
+            const Task task{node.object, node.output, inputSources.data() + node.firstInput,
+                            signals.data() + node.firstOutput};
+            outputSchedule.push_back(task);
+            if (node.update)
+            {
+                updateSchedule.push_back({node.object, node.update, task.sources, task.outputs});
+            }
+        }
+        compiled = true;
+    }
+
+    /**
+     * @brief Выполнить один шаг модели
+     */
+    void step()
+    {
+        if (!compiled)
+        {
+            throw std::logic_error("Model should be compiled before stepping");
+        }
+
+        const T currentTime = time();
+        const T* signalArray = signals.data();
+        for (const Task& task : outputSchedule)
+        {
+            task.function(task.object, BlockIO<T>{signalArray, task.sources, task.outputs, currentTime, stepSize});
+        }
+        for (const Task& task : updateSchedule)
+        {
+            task.function(task.object, BlockIO<T>{signalArray, task.sources, task.outputs, currentTime, stepSize});
+        }
+        ++stepCount;
+    }
+
+    /**
+     * @brief Задать значение внешнего входа, созданного addInport()
+     *
+     * @param inport Дескриптор внешнего входа
+     * @param value Новое значение
+     */
+    void setInput(BlockHandle inport, T value)
+    {
+        if (std::find(inports.begin(), inports.end(), inport.id) == inports.end())
+        {
+            throw std::invalid_argument("Block is not an inport");
+        }
+        *static_cast<T*>(nodes[inport.id].object) = value;
+    }
+
+    /**
+     * @brief Значение выхода блока, вычисленное на последнем шаге
+     *
+     * @param port Выход блока
+     * @return Ссылка на сигнал в массиве сигналов модели
+     */
+    const T& signal(OutputPort port) const
+    {
+        if (!compiled)
+        {
+            throw std::logic_error("Model should be compiled before reading signals");
+        }
+        return signals.at(nodes.at(port.block).firstOutput + port.index);
+    }
+
+    /**
+     * @brief Время следующего шага
+     */
+    T time() const
+    {
+        return startTime + static_cast<T>(stepCount) * stepSize;
+    }
+
+    /**
+     * @brief Номера блоков в порядке выполнения, вычисленном compile()
+     */
+    const std::vector<std::size_t>& executionOrder() const
+    {
+        return order;
+    }
+
+    /**
+     * @brief Количество зарегистрированных блоков
+     */
+    std::size_t size() const
+    {
+        return nodes.size();
+    }
+
+private:
+    /**
+     * @brief Добавить узел и выделить места для его входов и выходов
+     */
+    BlockHandle addNode(std::string name,
+                        std::size_t inputs,
+                        std::size_t outputs,
+                        bool directFeedthrough,
+                        void* object,
+                        OutputFunction output,
+                        OutputFunction update)
+    {
+        const std::size_t id = nodes.size();
+        std::size_t firstOutput = 0;
+        if (!nodes.empty())
+        {
+            firstOutput = nodes.back().firstOutput + nodes.back().outputs;
+        }
+
+        nodes.push_back({name.empty() ? "#" + std::to_string(id) : std::move(name),
+                         inputs, outputs, directFeedthrough, object, output, update,
+                         inputSources.size(), firstOutput});
+        inputSources.insert(inputSources.end(), inputs, unconnected);
+        compiled = false;
+        return {id};
+    }
+};
+}
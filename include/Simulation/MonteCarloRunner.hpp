@@ -0,0 +1,467 @@
+#pragma once
+
+#include "ThreadPool.hpp"
+#include "../Philox.hpp"
+#include "../WhiteNoiseGenerator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Потоковая статистика значения по алгоритму Уэлфорда
+ *
+ * Хранит только количество, среднее, сумму квадратов отклонений, минимум и
+ * максимум, поэтому не зависит от количества добавленных значений. Статистики,
+ * накопленные разными потоками, объединяются merge().
+ */
+class RunningStatistics
+{
+private:
+    std::size_t n = 0;                                             //!< Количество значений
+    double meanValue = 0.0;                                        //!< Среднее
+    double m2 = 0.0;                                               //!< Сумма квадратов отклонений от среднего
+    double minValue = std::numeric_limits<double>::infinity();     //!< Минимум
+    double maxValue = -std::numeric_limits<double>::infinity();    //!< Максимум
+
+public:
+    /**
+     * @brief Добавить значение
+     */
+    void add(double value)
+    {
+        ++n;
+        const double delta = value - meanValue;
+        meanValue += delta / static_cast<double>(n);
+        m2 += delta * (value - meanValue);
+        minValue = std::min(minValue, value);
+        maxValue = std::max(maxValue, value);
+    }
+
+    /**
+     * @brief Объединить со статистикой другой выборки (формула Чана)
+     */
+    void merge(const RunningStatistics& other)
+    {
+        if (other.n == 0)
+        {
+            return;
+        }
+        if (n == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        const double total = static_cast<double>(n + other.n);
+        const double delta = other.meanValue - meanValue;
+        meanValue += delta * static_cast<double>(other.n) / total;
+        m2 += other.m2 + delta * delta * static_cast<double>(n) * static_cast<double>(other.n) / total;
+        n += other.n;
+        minValue = std::min(minValue, other.minValue);
+        maxValue = std::max(maxValue, other.maxValue);
+    }
+
+    /**
+     * @brief Количество значений
+     */
+    std::size_t count() const
+    {
+        return n;
+    }
+
+    /**
+     * @brief Среднее значение
+     */
+    double mean() const
+    {
+        return meanValue;
+    }
+
+    /**
+     * @brief Несмещённая оценка дисперсии (0 при менее чем двух значениях)
+     */
+    double variance() const
+    {
+        return n < 2 ? 0.0 : m2 / static_cast<double>(n - 1);
+    }
+
+    /**
+     * @brief Среднеквадратическое отклонение
+     */
+    double stddev() const
+    {
+        return std::sqrt(variance());
+    }
+
+    /**
+     * @brief Наименьшее значение
+     */
+    double min() const
+    {
+        return minValue;
+    }
+
+    /**
+     * @brief Наибольшее значение
+     */
+    double max() const
+    {
+        return maxValue;
+    }
+};
+
+namespace detail
+{
+/**
+ * @brief Равномерное число в [0, 1) из 53 бит двух значений Philox4x32
+ *
+ * В отличие от std::generate_canonical, результат не зависит от стандартной
+ * библиотеки и никогда не равен 1.
+ */
+inline double uniform53(Philox4x32& engine)
+{
+    const std::uint64_t high = engine() >> 5; // 27 старших бит
+    const std::uint64_t low  = engine() >> 6; // 26 младших бит
+    return static_cast<double>((high << 26) | low) * (1.0 / 9007199254740992.0);
+}
+}
+
+/**
+ * @brief Описание разброса параметров сценария
+ *
+ * Параметры нумеруются в порядке добавления; значения каждого прогона
+ * выбираются из его собственного потока случайных чисел.
+ */
+class Dispersion
+{
+private:
+    /**
+     * @brief Закон распределения параметра
+     */
+    enum class Law
+    {
+        Uniform, //!< Равномерное на [first, second)
+        Normal   //!< Нормальное со средним first и отклонением second
+    };
+
+    /**
+     * @brief Параметр с разбросом
+     */
+    struct Parameter
+    {
+        std::string name; //!< Имя параметра
+        Law law;          //!< Закон распределения
+        double first;     //!< Минимум или среднее
+        double second;    //!< Максимум или отклонение
+    };
+
+    std::vector<Parameter> parameters; //!< Параметры в порядке добавления
+
+public:
+    /**
+     * @brief Добавить параметр, равномерно распределённый на [min, max)
+     *
+     * @return Номер параметра
+     */
+    std::size_t addUniform(std::string name, double min, double max)
+    {
+        if (min > max)
+        {
+            throw std::invalid_argument("Min value should not be greater than max value");
+        }
+        return add({std::move(name), Law::Uniform, min, max});
+    }
+
+    /**
+     * @brief Добавить нормально распределённый параметр
+     *
+     * @return Номер параметра
+     */
+    std::size_t addNormal(std::string name, double mean, double stddev)
+    {
+        if (stddev < 0.0)
+        {
+            throw std::invalid_argument("Standard deviation should not be negative");
+        }
+        return add({std::move(name), Law::Normal, mean, stddev});
+    }
+
+    /**
+     * @brief Количество параметров
+     */
+    std::size_t size() const
+    {
+        return parameters.size();
+    }
+
+    /**
+     * @brief Номер параметра с заданным именем
+     */
+    std::size_t index(const std::string& name) const
+    {
+        for (std::size_t i = 0; i < parameters.size(); ++i)
+        {
+            if (parameters[i].name == name)
+            {
+                return i;
+            }
+        }
+        throw std::invalid_argument("Unknown dispersion parameter: " + name);
+    }
+
+    /**
+     * @brief Выбрать значения всех параметров
+     *
+     * @param engine Генератор случайных битов прогона
+     * @param values Массив из size() значений
+     */
+    void sample(Philox4x32& engine, double* values) const
+    {
+        for (std::size_t i = 0; i < parameters.size(); ++i)
+        {
+            const Parameter& parameter = parameters[i];
+            if (parameter.law == Law::Uniform)
+            {
+                const double value = parameter.first
+                                   + (parameter.second - parameter.first) * detail::uniform53(engine);
+                // Округление суммы может дать верхнюю границу, которая в [min, max) не входит
+                values[i] = value < parameter.second || !(parameter.first < parameter.second)
+                          ? value
+                          : std::nextafter(parameter.second, parameter.first);
+            }
+            else
+            {
+                // Бокс-Мюллер библиотеки вместо std::normal_distribution, реализация которой
+                // различается между стандартными библиотеками
+                double u1 = 1.0 - detail::uniform53(engine);
+                double u2 = detail::uniform53(engine);
+                double normal[2];
+                detail::boxMuller(&u1, &u2, normal, 1, parameter.first, parameter.second);
+                values[i] = normal[0];
+            }
+        }
+    }
+
+private:
+    std::size_t add(Parameter parameter)
+    {
+        for (const Parameter& existing : parameters)
+        {
+            if (existing.name == parameter.name)
+            {
+                throw std::invalid_argument("Dispersion parameter already exists: " + parameter.name);
+            }
+        }
+        parameters.push_back(std::move(parameter));
+        return parameters.size() - 1;
+    }
+};
+
+/**
+ * @brief Данные одного прогона, передаваемые сценарию
+ */
+class MonteCarloRun
+{
+private:
+    std::size_t runIndex;        //!< Номер прогона
+    const double* values;        //!< Значения параметров разброса
+    Philox4x32& runEngine;       //!< Генератор прогона
+
+public:
+    MonteCarloRun(std::size_t index, const double* parameterValues, Philox4x32& engine)
+        : runIndex{index}, values{parameterValues}, runEngine{engine}
+    {
+    }
+
+    /**
+     * @brief Номер прогона
+     */
+    std::size_t index() const
+    {
+        return runIndex;
+    }
+
+    /**
+     * @brief Значение параметра разброса с номером parameter
+     */
+    double parameter(std::size_t parameter) const
+    {
+        return values[parameter];
+    }
+
+    /**
+     * @brief Генератор прогона для шумов и возмущений сценария
+     *
+     * Продолжает поток, из которого выбраны параметры разброса.
+     */
+    Philox4x32& engine()
+    {
+        return runEngine;
+    }
+};
+
+/**
+ * @brief Итоги серии прогонов
+ */
+struct MonteCarloSummary
+{
+    std::vector<std::string> metricNames;       //!< Имена показателей
+    std::vector<RunningStatistics> metrics;     //!< Статистика каждого показателя
+    std::size_t runs = 0;                       //!< Количество прогонов
+    std::size_t threads = 0;                    //!< Количество потоков
+    double seconds = 0.0;                       //!< Время выполнения серии
+
+    /**
+     * @brief Статистика показателя с заданным именем
+     */
+    const RunningStatistics& metric(const std::string& name) const
+    {
+        for (std::size_t i = 0; i < metricNames.size(); ++i)
+        {
+            if (metricNames[i] == name)
+            {
+                return metrics[i];
+            }
+        }
+        throw std::invalid_argument("Unknown metric: " + name);
+    }
+
+    /**
+     * @brief Количество прогонов в секунду
+     */
+    double runsPerSecond() const
+    {
+        return seconds > 0.0 ? static_cast<double>(runs) / seconds : 0.0;
+    }
+};
+
+/**
+ * @brief Параллельное выполнение серии прогонов сценария с разбросом параметров
+ *
+ * Каждый прогон получает собственный поток Philox4x32(seed, номер прогона),
+ * из которого выбираются параметры разброса и берутся шумы сценария, поэтому
+ * значения показателей каждого прогона не зависят от количества потоков и
+ * распределения прогонов между ними. Прогоны выполняются пулом с перехватом
+ * работы; показатели каждого прогона сразу добавляются в статистику потока,
+ * и полные записи прогонов не хранятся. Статистики потоков объединяются в
+ * конце серии, поэтому средние могут отличаться от однопоточных в последних
+ * разрядах.
+ */
+class MonteCarloRunner
+{
+private:
+    Dispersion dispersion;               //!< Разброс параметров
+    std::vector<std::string> metricNames;//!< Имена показателей сценария
+    std::uint64_t seed;                  //!< Зерно серии
+    ThreadPool pool;                     //!< Пул потоков
+
+public:
+    /**
+     * @brief Конструктор
+     *
+     * @param dispersion Разброс параметров
+     * @param metricNames Имена показателей, возвращаемых сценарием
+     * @param seed Зерно серии
+     * @param threads Количество потоков; 0 - по числу аппаратных потоков
+     */
+    MonteCarloRunner(Dispersion dispersion,
+                     std::vector<std::string> metricNames,
+                     std::uint64_t seed = Philox4x32::defaultSeed,
+                     std::size_t threads = 0)
+        : dispersion{std::move(dispersion)}, metricNames{std::move(metricNames)}, seed{seed}, pool{threads}
+    {
+        if (this->metricNames.empty())
+        {
+            throw std::invalid_argument("At least one metric should be specified");
+        }
+    }
+
+    /**
+     * @brief Выполнить прогоны с номерами [firstRun, firstRun + runs)
+     *
+     * Сценарий вызывается как scenario(MonteCarloRun&), создаёт регуляторы и
+     * модель объекта по параметрам прогона, выполняет моделирование и
+     * возвращает показатели в контейнере с size() и operator[] (std::array,
+     * std::vector) в порядке metricNames. Сценарий вызывается из нескольких
+     * потоков одновременно.
+     *
+     * @param runs Количество прогонов
+     * @param scenario Сценарий
+     * @param firstRun Номер первого прогона (для продолжения серии)
+     * @return Статистика показателей
+     */
+    template <typename Scenario>
+    MonteCarloSummary run(std::size_t runs, Scenario&& scenario, std::size_t firstRun = 0)
+    {
+        const std::size_t metricCount = metricNames.size();
+        std::vector<std::vector<RunningStatistics>> workerMetrics(pool.size(),
+                                                                  std::vector<RunningStatistics>(metricCount));
+        std::vector<std::vector<double>> workerValues(pool.size(), std::vector<double>(dispersion.size()));
+
+        const auto start = std::chrono::steady_clock::now();
+        pool.parallelFor(runs, [&](std::size_t index, std::size_t worker)
+        {
+            const std::size_t runIndex = firstRun + index;
+            Philox4x32 engine(seed, runIndex);
+            double* values = workerValues[worker].data();
+            dispersion.sample(engine, values);
+
+            MonteCarloRun context(runIndex, values, engine);
+            const auto& result = scenario(context);
+            if (static_cast<std::size_t>(result.size()) != metricCount)
+            {
+                throw std::length_error("Scenario returned a wrong number of metrics");
+            }
+
+            std::vector<RunningStatistics>& statistics = workerMetrics[worker];
+            for (std::size_t metric = 0; metric < metricCount; ++metric)
+            {
+                statistics[metric].add(static_cast<double>(result[metric]));
+            }
+        });
+        const auto stop = std::chrono::steady_clock::now();
+
+        MonteCarloSummary summary;
+        summary.metricNames = metricNames;
+        summary.metrics.resize(metricCount);
+        for (const auto& statistics : workerMetrics)
+        {
+            for (std::size_t metric = 0; metric < metricCount; ++metric)
+            {
+                summary.metrics[metric].merge(statistics[metric]);
+            }
+        }
+        summary.runs    = runs;
+        summary.threads = pool.size();
+        summary.seconds = std::chrono::duration<double>(stop - start).count();
+        return summary;
+    }
+
+    /**
+     * @brief Номер параметра разброса с заданным именем
+     */
+    std::size_t parameterIndex(const std::string& name) const
+    {
+        return dispersion.index(name);
+    }
+
+    /**
+     * @brief Количество потоков
+     */
+    std::size_t threadCount() const
+    {
+        return pool.size();
+    }
+};
+}
@@ -0,0 +1,475 @@
+#pragma once
+
+#include "Model.hpp"
+#include "../ThreadingPolicy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+namespace detail
+{
+/**
+ * @brief Поток, выполняющий одну и ту же задачу по запросу
+ *
+ * launch() запускает задачу и сразу возвращает управление, wait() ждёт её
+ * завершения и передаёт исключение, выброшенное задачей, вызывающему потоку.
+ */
+class RateWorker
+{
+private:
+    std::function<void()> task;  //!< Выполняемая задача
+    std::mutex mtx;              //!< Мьютекс состояния потока
+    std::condition_variable cv;  //!< Оповещение о запуске и завершении задачи
+    bool pending = false;        //!< Запущена ли задача и не завершена
+    bool stopping = false;       //!< Запрошено ли завершение потока
+    std::exception_ptr error;    //!< Исключение, выброшенное задачей
+    std::thread thread;          //!< Рабочий поток
+
+public:
+    explicit RateWorker(std::function<void()> job)
+        : task{std::move(job)}, thread{[this] { run(); }}
+    {
+    }
+
+    RateWorker(const RateWorker&) = delete;
+    RateWorker& operator=(const RateWorker&) = delete;
+
+    ~RateWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        thread.join();
+    }
+
+    /**
+     * @brief Запустить задачу; предыдущий запуск должен быть завершён wait()
+     */
+    void launch()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            pending = true;
+        }
+        cv.notify_all();
+    }
+
+    /**
+     * @brief Дождаться завершения задачи
+     */
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this] { return !pending; });
+        if (error)
+        {
+            std::exception_ptr thrown = error;
+            error = nullptr;
+            std::rethrow_exception(thrown);
+        }
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true)
+        {
+            cv.wait(lock, [this] { return pending || stopping; });
+            if (stopping)
+            {
+                return;
+            }
+
+            lock.unlock();
+            std::exception_ptr thrown;
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                thrown = std::current_exception();
+            }
+            lock.lock();
+
+            error = thrown;
+            pending = false;
+            cv.notify_all();
+        }
+    }
+};
+}
+
+/**
+ * @brief Планировщик модели с несколькими частотами дискретизации
+ *
+ * Блоки группируются по периоду: каждая группа - отдельная модель Model с шагом,
+ * кратным базовому периоду планировщика, и выполняется только на своих тактах.
+ * На каждом базовом такте группы выполняются в порядке возрастания периода
+ * (rate-monotonic), поэтому быстрые контуры не ждут медленных.
+ *
+ * Сигналы между группами передаются только через переходы частоты, которые
+ * выбираются по направлению передачи и делают результат детерминированным:
+ * - из быстрой группы в медленную - фиксатор нулевого порядка: медленная
+ *   группа на своём такте читает значение, вычисленное быстрой группой на
+ *   том же или последнем предыдущем такте;
+ * - из медленной группы в быструю - задержка на один период медленной группы:
+ *   быстрая группа до следующего такта медленной читает значение, вычисленное
+ *   медленной группой на её предыдущем такте.
+ *
+ * Поэтому медленную группу можно выполнять в отдельном потоке (Execution::Thread):
+ * она запускается на своём такте и должна завершиться к своему следующему такту,
+ * а результаты совпадают с однопоточным выполнением. Планировщик ждёт завершения
+ * группы перед её следующим запуском и перед передачей сигналов, которые она читает
+ * или записывает.
+ *
+ * @tparam T Тип сигналов модели
+ */
+template <typename T = double>
+class MultiRateScheduler
+{
+public:
+    /**
+     * @brief Способ выполнения группы
+     */
+    enum class Execution
+    {
+        Inline, //!< В потоке, вызвавшем step()
+        Thread  //!< В отдельном потоке группы
+    };
+
+    /**
+     * @brief Дескриптор группы блоков с общим периодом
+     */
+    struct RateHandle
+    {
+        std::size_t id; //!< Номер группы
+    };
+
+private:
+    /**
+     * @brief Группа блоков с общим периодом
+     */
+    struct Group
+    {
+        Model<T> model;                              //!< Блоки группы
+        unsigned long long multiple;                 //!< Период в базовых тактах
+        Execution execution;                         //!< Способ выполнения
+        std::unique_ptr<detail::RateWorker> worker;  //!< Поток группы (для Execution::Thread)
+    };
+
+    /**
+     * @brief Переход частоты между группами
+     */
+    struct Transition
+    {
+        std::size_t source;                               //!< Группа-источник
+        typename Model<T>::OutputPort port;               //!< Выход в группе-источнике
+        std::size_t destination;                          //!< Группа-приёмник
+        typename Model<T>::BlockHandle inport;            //!< Вход в группе-приёмнике
+        const T* value = nullptr;                         //!< Сигнал источника после компиляции
+    };
+
+    T basePeriod;                                //!< Базовый период
+    T startTime;                                 //!< Время первого такта
+    unsigned long long tickCount = 0;            //!< Количество выполненных базовых тактов
+    std::vector<std::unique_ptr<Group>> groups;  //!< Группы в порядке добавления
+    std::vector<std::size_t> order;              //!< Группы в порядке возрастания периода
+    std::vector<Transition> holds;               //!< Переходы из быстрых групп в медленные
+    std::vector<Transition> delays;              //!< Переходы из медленных групп в быстрые
+    bool compiled = false;                       //!< Актуально ли расписание
+
+public:
+    /**
+     * @brief Конструктор планировщика
+     *
+     * @param basePeriod Базовый период, которому кратны периоды всех групп
+     * @param t0 Время первого такта
+     */
+    explicit MultiRateScheduler(T basePeriod, T t0 = T(0))
+        : basePeriod{basePeriod}, startTime{t0}
+    {
+        if (!(basePeriod > T(0)))
+        {
+            throw std::invalid_argument("Base period should be positive");
+        }
+    }
+
+    // Потоки групп ссылаются на модели планировщика
+    MultiRateScheduler(const MultiRateScheduler&) = delete;
+    MultiRateScheduler& operator=(const MultiRateScheduler&) = delete;
+
+    ~MultiRateScheduler()
+    {
+        stopWorkers();
+    }
+
+    /**
+     * @brief Добавить группу блоков с периодом period
+     *
+     * @param period Период группы, кратный базовому периоду
+     * @param execution Способ выполнения группы
+     * @return Дескриптор группы
+     */
+    RateHandle addRate(T period, Execution execution = Execution::Inline)
+    {
+        if (tickCount > 0)
+        {
+            throw std::logic_error("Rate groups should be added before the first step");
+        }
+
+        // Допуск в единицах точности T: периоды 0.001 и 0.01 не кратны точно ни в float, ни в double
+        const T ratio = period / basePeriod;
+        const T rounded = std::round(ratio);
+        if (!(rounded >= T(1)) || std::fabs(ratio - rounded) > T(8) * std::numeric_limits<T>::epsilon() * ratio)
+        {
+            throw std::invalid_argument("Period should be a positive multiple of the base period");
+        }
+
+        const auto multiple = static_cast<unsigned long long>(rounded);
+        for (const auto& group : groups)
+        {
+            if (group->multiple == multiple)
+            {
+                throw std::invalid_argument("Rate group with the same period already exists");
+            }
+        }
+
+        stopWorkers();
+        groups.push_back(std::make_unique<Group>(Group{Model<T>(period, startTime), multiple, execution, nullptr}));
+        compiled = false;
+        return {groups.size() - 1};
+    }
+
+    /**
+     * @brief Модель группы для добавления и соединения блоков
+     *
+     * Сигналы группы, выполняемой в отдельном потоке, читаются после synchronize().
+     */
+    Model<T>& model(RateHandle rate)
+    {
+        return groups.at(rate.id)->model;
+    }
+
+    /**
+     * @brief Передать выход блока одной группы в другую через переход частоты
+     *
+     * В группе-приёмнике создаётся внешний вход, который нужно соединить со
+     * входами её блоков. Вид перехода определяется соотношением периодов.
+     *
+     * @param from Группа-источник
+     * @param port Выход блока в группе-источнике
+     * @param to Группа-приёмник
+     * @param initial Значение входа до первой передачи
+     * @return Дескриптор внешнего входа в группе-приёмнике
+     */
+    typename Model<T>::BlockHandle connect(RateHandle from,
+                                           typename Model<T>::OutputPort port,
+                                           RateHandle to,
+                                           T initial = T(0))
+    {
+        Group& source = *groups.at(from.id);
+        Group& destination = *groups.at(to.id);
+        if (from.id == to.id)
+        {
+            throw std::invalid_argument("Signals inside a rate group should be connected by its model");
+        }
+
+        const auto inport = destination.model.addInport("RateTransition");
+        destination.model.setInput(inport, initial);
+        const Transition transition{from.id, port, to.id, inport};
+        if (source.multiple < destination.multiple)
+        {
+            holds.push_back(transition);
+        }
+        else
+        {
+            delays.push_back(transition);
+        }
+        compiled = false;
+        return inport;
+    }
+
+    /**
+     * @brief Скомпилировать модели всех групп и запустить потоки групп
+     */
+    void compile()
+    {
+        stopWorkers();
+        for (auto& group : groups)
+        {
+            group->model.compile();
+        }
+        for (Transition& transition : holds)
+        {
+            transition.value = &groups[transition.source]->model.signal(transition.port);
+        }
+        for (Transition& transition : delays)
+        {
+            transition.value = &groups[transition.source]->model.signal(transition.port);
+        }
+
+        order.resize(groups.size());
+        for (std::size_t id = 0; id < groups.size(); ++id)
+        {
+            order[id] = id;
+        }
+        std::sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b)
+        {
+            return groups[a]->multiple < groups[b]->multiple;
+        });
+
+        for (auto& group : groups)
+        {
+            if (group->execution == Execution::Thread)
+            {
+                Model<T>* model = &group->model;
+                group->worker = std::make_unique<detail::RateWorker>([model] { model->step(); });
+            }
+        }
+        compiled = true;
+    }
+
+    /**
+     * @brief Выполнить один базовый такт
+     *
+     * Группы, выполняемые в отдельных потоках, могут продолжать работу после
+     * возврата; synchronize() дожидается их завершения.
+     */
+    void step()
+    {
+        if (!compiled)
+        {
+            throw std::logic_error("Scheduler should be compiled before stepping");
+        }
+
+        // Медленные группы публикуют результат предыдущего запуска; до первого
+        // запуска приёмник получает начальное значение перехода
+        for (const Transition& transition : delays)
+        {
+            if (tickCount > 0 && hits(*groups[transition.source]))
+            {
+                wait(*groups[transition.source]);
+                wait(*groups[transition.destination]);
+                groups[transition.destination]->model.setInput(transition.inport, *transition.value);
+            }
+        }
+
+        for (std::size_t id : order)
+        {
+            Group& group = *groups[id];
+            if (!hits(group))
+            {
+                continue;
+            }
+
+            wait(group);
+            // Быстрые группы уже выполнены на этом такте
+            for (const Transition& transition : holds)
+            {
+                if (transition.destination == id)
+                {
+                    wait(*groups[transition.source]);
+                    group.model.setInput(transition.inport, *transition.value);
+                }
+            }
+
+            if (group.worker)
+            {
+                group.worker->launch();
+            }
+            else
+            {
+                group.model.step();
+            }
+        }
+        ++tickCount;
+    }
+
+    /**
+     * @brief Дождаться завершения групп, выполняемых в отдельных потоках
+     */
+    void synchronize()
+    {
+        for (auto& group : groups)
+        {
+            wait(*group);
+        }
+    }
+
+    /**
+     * @brief Время следующего базового такта
+     */
+    T time() const
+    {
+        return startTime + static_cast<T>(tickCount) * basePeriod;
+    }
+
+    /**
+     * @brief Номера групп в порядке выполнения на такте
+     */
+    const std::vector<std::size_t>& executionOrder() const
+    {
+        return order;
+    }
+
+private:
+    /**
+     * @brief Выполняется ли группа на текущем такте
+     */
+    bool hits(const Group& group) const
+    {
+        return tickCount % group.multiple == 0;
+    }
+
+    /**
+     * @brief Дождаться завершения группы, если она выполняется в отдельном потоке
+     */
+    static void wait(Group& group)
+    {
+        if (group.worker)
+        {
+            group.worker->wait();
+        }
+    }
+
+    /**
+     * @brief Дождаться групп и остановить их потоки
+     */
+    void stopWorkers()
+    {
+        for (auto& group : groups)
+        {
+            if (group->worker)
+            {
+                // Исключение незавершённого запуска уже не может быть передано
+                try
+                {
+                    group->worker->wait();
+                }
+                catch (...)
+                {
+                }
+                group->worker.reset();
+            }
+        }
+        compiled = false;
+    }
+};
+}
@@ -0,0 +1,531 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Метод интегрирования непрерывных состояний
+ */
+enum class SolverMethod
+{
+    Euler,         //!< Явный метод Эйлера, 1-й порядок (как IntegratorBlock::step)
+    RungeKutta4,   //!< Классический метод Рунге-Кутты 4-го порядка
+    Trapezoidal,   //!< Неявный метод трапеций, 2-й порядок, A-устойчив
+    DormandPrince  //!< Метод Дормана-Принса 5(4) с автоматическим выбором шага
+};
+
+/**
+ * @brief Параметры решателя
+ */
+struct SolverOptions
+{
+    SolverMethod method = SolverMethod::RungeKutta4; //!< Метод интегрирования
+    double relativeTolerance = 1e-6;                 //!< Относительная точность (DormandPrince, Newton)
+    double absoluteTolerance = 1e-9;                 //!< Абсолютная точность (DormandPrince, Newton)
+    double initialStep = 0.0;                        //!< Начальный шаг DormandPrince; 0 - выбирается автоматически
+    double minStep = 1e-12;                          //!< Наименьший шаг DormandPrince
+    double maxStep = std::numeric_limits<double>::infinity(); //!< Наибольший шаг DormandPrince
+    std::size_t newtonIterations = 10;               //!< Наибольшее количество итераций Ньютона (Trapezoidal)
+};
+
+/**
+ * @brief Счётчики работы решателя
+ */
+struct SolverStatistics
+{
+    std::size_t steps = 0;        //!< Принятые шаги
+    std::size_t rejected = 0;     //!< Отвергнутые шаги (DormandPrince)
+    std::size_t evaluations = 0;  //!< Вычисления производных
+    std::size_t jacobians = 0;    //!< Вычисления матрицы Якоби (Trapezoidal)
+};
+
+/**
+ * @brief Решатель системы x' = f(t, x) фиксированной размерности
+ *
+ * Система задаётся функцией f(t, x, dx), записывающей производные состояний
+ * x в массив dx. Все рабочие массивы выделяются в конструкторе, поэтому шаги
+ * не выделяют память.
+ *
+ * advance(f, t, x, duration) продвигает состояние на duration: методы с
+ * фиксированным шагом делают один шаг длины duration, DormandPrince - столько
+ * шагов, сколько требует заданная точность; найденный шаг сохраняется между
+ * вызовами, поэтому на спокойных участках шаги увеличиваются.
+ *
+ * @tparam T Тип состояний
+ */
+template <typename T = double>
+class OdeSolver
+{
+private:
+    SolverOptions options;                   //!< Параметры решателя
+    std::size_t n;                           //!< Количество состояний
+    std::vector<std::vector<T>> k;           //!< Производные на стадиях
+    std::vector<T> stage;                    //!< Состояние на стадии
+    std::vector<T> next;                     //!< Состояние в конце шага
+    std::vector<T> jacobian;                 //!< Матрица Ньютона (I - h/2 J), построчно, после LU-разложения
+    std::vector<std::size_t> pivots;         //!< Перестановки строк LU-разложения
+    T proposedStep = T(0);                   //!< Шаг, предложенный DormandPrince для следующего шага
+    bool interrupted = false;                //!< Запрошена ли остановка advance после текущего шага
+    SolverStatistics stats;                  //!< Счётчики работы
+
+public:
+    /**
+     * @brief Конструктор решателя
+     *
+     * @param dimension Количество состояний
+     * @param solverOptions Параметры решателя
+     */
+    explicit OdeSolver(std::size_t dimension, SolverOptions solverOptions = {})
+        : options{solverOptions}, n{dimension},
+          k(7, std::vector<T>(dimension)), stage(dimension), next(dimension)
+    {
+        if (!(options.relativeTolerance > 0.0) || !(options.absoluteTolerance >= 0.0))
+        {
+            throw std::invalid_argument("Tolerances should be positive");
+        }
+        if (!(options.minStep > 0.0) || options.maxStep < options.minStep)
+        {
+            throw std::invalid_argument("Min step should be positive and not greater than max step");
+        }
+        if (options.method == SolverMethod::Trapezoidal)
+        {
+            jacobian.resize(dimension * dimension);
+            pivots.resize(dimension);
+        }
+        proposedStep = static_cast<T>(options.initialStep);
+    }
+
+    /**
+     * @brief Продвинуть состояние x из момента t на duration
+     *
+     * @param f Функция f(t, x, dx)
+     * @param t Время, увеличивается на duration
+     * @param x Массив состояний
+     * @param duration Интервал интегрирования
+     */
+    template <typename System>
+    void advance(System&& f, T& t, T* x, T duration)
+    {
+        advance(std::forward<System>(f), t, x, duration, [](T, T*) { return false; });
+    }
+
+    /**
+     * @brief Продвинуть состояние с вызовом onStep(t, x) после каждого принятого шага
+     *
+     * onStep может изменить состояния (например, ограничить их пределами) и
+     * должен вернуть true, если изменил их.
+     */
+    template <typename System, typename OnStep>
+    void advance(System&& f, T& t, T* x, T duration, OnStep&& onStep)
+    {
+        if (!(duration > T(0)))
+        {
+            throw std::invalid_argument("Integration interval should be positive");
+        }
+        interrupted = false;
+
+        switch (options.method)
+        {
+        case SolverMethod::Euler:
+            euler(f, t, x, duration);
+            break;
+        case SolverMethod::RungeKutta4:
+            rungeKutta4(f, t, x, duration);
+            break;
+        case SolverMethod::Trapezoidal:
+            trapezoidal(f, t, x, duration);
+            break;
+        case SolverMethod::DormandPrince:
+            dormandPrince(f, t, x, duration, onStep);
+            return;
+        }
+        ++stats.steps;
+        onStep(t, x);
+    }
+
+    /**
+     * @brief Остановить advance после текущего принятого шага
+     *
+     * Вызывается из onStep; t и x остаются равными концу этого шага.
+     * Методы с фиксированным шагом и так делают один шаг за вызов.
+     */
+    void interrupt()
+    {
+        interrupted = true;
+    }
+
+    /**
+     * @brief Количество состояний
+     */
+    std::size_t dimension() const
+    {
+        return n;
+    }
+
+    /**
+     * @brief Шаг, с которого DormandPrince начнёт следующий вызов advance
+     */
+    T nextStep() const
+    {
+        return proposedStep;
+    }
+
+    /**
+     * @brief Счётчики работы решателя
+     */
+    const SolverStatistics& statistics() const
+    {
+        return stats;
+    }
+
+private:
+    template <typename System>
+    void evaluate(System& f, T time, const T* state, T* derivative)
+    {
+        f(time, state, derivative);
+        ++stats.evaluations;
+    }
+
+    template <typename System>
+    void euler(System& f, T& t, T* x, T h)
+    {
+        evaluate(f, t, x, k[0].data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[i] += h * k[0][i];
+        }
+        t += h;
+    }
+
+    template <typename System>
+    void rungeKutta4(System& f, T& t, T* x, T h)
+    {
+        evaluate(f, t, x, k[0].data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            stage[i] = x[i] + h / 2 * k[0][i];
+        }
+        evaluate(f, t + h / 2, stage.data(), k[1].data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            stage[i] = x[i] + h / 2 * k[1][i];
+        }
+        evaluate(f, t + h / 2, stage.data(), k[2].data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            stage[i] = x[i] + h * k[2][i];
+        }
+        evaluate(f, t + h, stage.data(), k[3].data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x[i] += h / 6 * (k[0][i] + 2 * k[1][i] + 2 * k[2][i] + k[3][i]);
+        }
+        t += h;
+    }
+
+    /**
+     * @brief Шаг метода трапеций: x1 = x0 + h/2 (f(t, x0) + f(t + h, x1))
+     *
+     * Уравнение решается упрощённым методом Ньютона: матрица Якоби
+     * вычисляется конечными разностями один раз за шаг в точке прогноза
+     * методом Эйлера.
+     */
+    template <typename System>
+    void trapezoidal(System& f, T& t, T* x, T h)
+    {
+        std::vector<T>& f0 = k[0];
+        std::vector<T>& f1 = k[1];
+        std::vector<T>& base = k[2];
+        std::vector<T>& delta = k[3];
+        const T t1 = t + h;
+
+        evaluate(f, t, x, f0.data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            next[i] = x[i] + h * f0[i];
+        }
+
+        // Матрица I - h/2 J по столбцам конечных разностей
+        evaluate(f, t1, next.data(), base.data());
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            const T saved = next[j];
+            const T increment = std::sqrt(std::numeric_limits<T>::epsilon()) * std::max(std::fabs(saved), T(1));
+            next[j] = saved + increment;
+            evaluate(f, t1, next.data(), f1.data());
+            next[j] = saved;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                jacobian[i * n + j] = (i == j ? T(1) : T(0)) - h / 2 * (f1[i] - base[i]) / increment;
+            }
+        }
+        ++stats.jacobians;
+        factorize();
+
+        f1 = base;
+        for (std::size_t iteration = 0; iteration < options.newtonIterations; ++iteration)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                delta[i] = next[i] - x[i] - h / 2 * (f0[i] + f1[i]);
+            }
+            solve(delta.data());
+
+            T norm = T(0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                next[i] -= delta[i];
+                const T scale = static_cast<T>(options.absoluteTolerance)
+                              + static_cast<T>(options.relativeTolerance) * std::fabs(next[i]);
+                norm = std::max(norm, std::fabs(delta[i]) / scale);
+            }
+            if (norm <= T(1))
+            {
+                std::copy(next.begin(), next.end(), x);
+                t = t1;
+                return;
+            }
+            evaluate(f, t1, next.data(), f1.data());
+        }
+        throw std::runtime_error("Newton iterations of the trapezoidal solver did not converge");
+    }
+
+    /**
+     * @brief LU-разложение матрицы jacobian с выбором главного элемента
+     */
+    void factorize()
+    {
+        for (std::size_t column = 0; column < n; ++column)
+        {
+            std::size_t pivot = column;
+            for (std::size_t row = column + 1; row < n; ++row)
+            {
+                if (std::fabs(jacobian[row * n + column]) > std::fabs(jacobian[pivot * n + column]))
+                {
+                    pivot = row;
+                }
+            }
+            if (jacobian[pivot * n + column] == T(0))
+            {
+                throw std::runtime_error("Newton matrix of the trapezoidal solver is singular");
+            }
+            pivots[column] = pivot;
+            if (pivot != column)
+            {
+                std::swap_ranges(jacobian.begin() + pivot * n, jacobian.begin() + (pivot + 1) * n,
+                                 jacobian.begin() + column * n);
+            }
+            for (std::size_t row = column + 1; row < n; ++row)
+            {
+                const T factor = jacobian[row * n + column] / jacobian[column * n + column];
+                jacobian[row * n + column] = factor;
+                for (std::size_t j = column + 1; j < n; ++j)
+                {
+                    jacobian[row * n + j] -= factor * jacobian[column * n + j];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Решить систему с LU-разложенной матрицей, правая часть заменяется решением
+     */
+    void solve(T* vector) const
+    {
+        for (std::size_t row = 0; row < n; ++row)
+        {
+            std::swap(vector[row], vector[pivots[row]]);
+            for (std::size_t j = 0; j < row; ++j)
+            {
+                vector[row] -= jacobian[row * n + j] * vector[j];
+            }
+        }
+        for (std::size_t row = n; row-- > 0;)
+        {
+            for (std::size_t j = row + 1; j < n; ++j)
+            {
+                vector[row] -= jacobian[row * n + j] * vector[j];
+            }
+            vector[row] /= jacobian[row * n + row];
+        }
+    }
+
+    /**
+     * @brief Шаги метода Дормана-Принса 5(4) до момента t + duration
+     *
+     * Используется свойство FSAL: производная в конце принятого шага
+     * служит первой стадией следующего. Погрешность оценивается разностью
+     * решений 5-го и 4-го порядков в среднеквадратической норме с весами
+     * absoluteTolerance + relativeTolerance * |x|.
+     */
+    template <typename System, typename OnStep>
+    void dormandPrince(System& f, T& t, T* x, T duration, OnStep& onStep)
+    {
+        constexpr T c2 = T(1) / 5, c3 = T(3) / 10, c4 = T(4) / 5, c5 = T(8) / 9;
+        constexpr T a21 = T(1) / 5;
+        constexpr T a31 = T(3) / 40, a32 = T(9) / 40;
+        constexpr T a41 = T(44) / 45, a42 = T(-56) / 15, a43 = T(32) / 9;
+        constexpr T a51 = T(19372) / 6561, a52 = T(-25360) / 2187, a53 = T(64448) / 6561, a54 = T(-212) / 729;
+        constexpr T a61 = T(9017) / 3168, a62 = T(-355) / 33, a63 = T(46732) / 5247, a64 = T(49) / 176,
+                    a65 = T(-5103) / 18656;
+        constexpr T b1 = T(35) / 384, b3 = T(500) / 1113, b4 = T(125) / 192, b5 = T(-2187) / 6784, b6 = T(11) / 84;
+        constexpr T e1 = T(71) / 57600, e3 = T(-71) / 16695, e4 = T(71) / 1920, e5 = T(-17253) / 339200,
+                    e6 = T(22) / 525, e7 = T(-1) / 40;
+
+        const T end = t + duration;
+        evaluate(f, t, x, k[0].data());
+        if (!(proposedStep > T(0)))
+        {
+            proposedStep = initialStep(f, t, x, duration);
+        }
+
+        bool rejectedBefore = false;
+        while (end - t > std::numeric_limits<T>::epsilon() * std::max(std::fabs(end), T(1)) * 4)
+        {
+            const T remaining = end - t;
+            const T h = std::min({proposedStep, remaining, static_cast<T>(options.maxStep)});
+            const bool truncated = h < proposedStep;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                stage[i] = x[i] + h * a21 * k[0][i];
+            }
+            evaluate(f, t + c2 * h, stage.data(), k[1].data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                stage[i] = x[i] + h * (a31 * k[0][i] + a32 * k[1][i]);
+            }
+            evaluate(f, t + c3 * h, stage.data(), k[2].data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                stage[i] = x[i] + h * (a41 * k[0][i] + a42 * k[1][i] + a43 * k[2][i]);
+            }
+            evaluate(f, t + c4 * h, stage.data(), k[3].data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                stage[i] = x[i] + h * (a51 * k[0][i] + a52 * k[1][i] + a53 * k[2][i] + a54 * k[3][i]);
+            }
+            evaluate(f, t + c5 * h, stage.data(), k[4].data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                stage[i] = x[i] + h * (a61 * k[0][i] + a62 * k[1][i] + a63 * k[2][i] + a64 * k[3][i]
+                                       + a65 * k[4][i]);
+            }
+            evaluate(f, t + h, stage.data(), k[5].data());
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                next[i] = x[i] + h * (b1 * k[0][i] + b3 * k[2][i] + b4 * k[3][i] + b5 * k[4][i] + b6 * k[5][i]);
+            }
+            evaluate(f, t + h, next.data(), k[6].data());
+
+            T error = T(0);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const T estimate = h * (e1 * k[0][i] + e3 * k[2][i] + e4 * k[3][i] + e5 * k[4][i]
+                                        + e6 * k[5][i] + e7 * k[6][i]);
+                const T scale = static_cast<T>(options.absoluteTolerance)
+                              + static_cast<T>(options.relativeTolerance) * std::max(std::fabs(x[i]), std::fabs(next[i]));
+                error += (estimate / scale) * (estimate / scale);
+            }
+            error = n == 0 ? T(0) : std::sqrt(error / static_cast<T>(n));
+            if (std::isnan(error))
+            {
+                error = std::numeric_limits<T>::infinity();
+            }
+
+            // Множитель шага 0.9 * error^(-1/5), ограниченный [0.2, 5]
+            T factor = error == T(0) ? T(5) : std::clamp(T(0.9) * std::pow(error, T(-0.2)), T(0.2), T(5));
+            if (error <= T(1) || h <= static_cast<T>(options.minStep))
+            {
+                if (!std::isfinite(error))
+                {
+                    throw std::runtime_error("Dormand-Prince solver diverged");
+                }
+                t = (h == remaining) ? end : t + h;
+                std::copy(next.begin(), next.end(), x);
+                std::swap(k[0], k[6]);
+                ++stats.steps;
+                if (onStep(t, x))
+                {
+                    evaluate(f, t, x, k[0].data());
+                }
+
+                if (rejectedBefore)
+                {
+                    factor = std::min(factor, T(1));
+                }
+                // Укороченный до конца интервала шаг не уменьшает следующий
+                if (!truncated)
+                {
+                    proposedStep = h * factor;
+                }
+                else
+                {
+                    proposedStep = std::max(proposedStep, h * factor);
+                }
+                rejectedBefore = false;
+                if (interrupted)
+                {
+                    return;
+                }
+            }
+            else
+            {
+                ++stats.rejected;
+                proposedStep = std::max(h * factor, static_cast<T>(options.minStep));
+                rejectedBefore = true;
+            }
+        }
+    }
+
+    /**
+     * @brief Начальный шаг по оценке Хайрера-Нёрсетта-Ваннера
+     *
+     * k[0] должен содержать f(t, x).
+     */
+    template <typename System>
+    T initialStep(System& f, T t, const T* x, T duration)
+    {
+        T d0 = T(0);
+        T d1 = T(0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const T scale = static_cast<T>(options.absoluteTolerance)
+                          + static_cast<T>(options.relativeTolerance) * std::fabs(x[i]);
+            d0 += (x[i] / scale) * (x[i] / scale);
+            d1 += (k[0][i] / scale) * (k[0][i] / scale);
+        }
+        d0 = std::sqrt(d0 / static_cast<T>(std::max<std::size_t>(n, 1)));
+        d1 = std::sqrt(d1 / static_cast<T>(std::max<std::size_t>(n, 1)));
+
+        T h0 = (d0 < T(1e-5) || d1 < T(1e-5)) ? T(1e-6) : T(0.01) * d0 / d1;
+        h0 = std::min(h0, duration);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            stage[i] = x[i] + h0 * k[0][i];
+        }
+        evaluate(f, t + h0, stage.data(), k[1].data());
+
+        T d2 = T(0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const T scale = static_cast<T>(options.absoluteTolerance)
+                          + static_cast<T>(options.relativeTolerance) * std::fabs(x[i]);
+            d2 += ((k[1][i] - k[0][i]) / scale) * ((k[1][i] - k[0][i]) / scale);
+        }
+        d2 = std::sqrt(d2 / static_cast<T>(std::max<std::size_t>(n, 1))) / h0;
+
+        const T largest = std::max(d1, d2);
+        const T h1 = largest <= T(1e-15) ? std::max(T(1e-6), h0 * T(1e-3)) : std::pow(T(0.01) / largest, T(0.2));
+        return std::clamp(std::min(T(100) * h0, h1), static_cast<T>(options.minStep), static_cast<T>(options.maxStep));
+    }
+};
+}
@@ -0,0 +1,508 @@
+#pragma once
+
+#include "ThreadPool.hpp"
+#include "../PID.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Коэффициенты ПИД-регулятора
+ */
+struct PidGains
+{
+    double p = 0.0; //!< Пропорциональный коэффициент
+    double i = 0.0; //!< Интегральный коэффициент
+    double d = 0.0; //!< Дифференциальный коэффициент
+
+    /**
+     * @brief Загрузить коэффициенты в регулятор (PID::setCoeffs)
+     */
+    template <typename Controller>
+    void applyTo(Controller& controller) const
+    {
+        controller.setCoeffs(p, i, d);
+    }
+};
+
+/**
+ * @brief Параметры оценки переходного процесса
+ *
+ * Стоимость набора коэффициентов:
+ * iseWeight * ISE + itaeWeight * ITAE + overshootWeight * перерегулирование,
+ * где перерегулирование - доля превышения выходом ступенчатого задания.
+ */
+struct TuningOptions
+{
+    double dt = 0.01;                 //!< Шаг моделирования
+    double duration = 10.0;           //!< Длительность переходного процесса
+    double reference = 1.0;           //!< Ступенчатое задание
+    double iseWeight = 1.0;           //!< Вес интеграла квадрата ошибки
+    double itaeWeight = 0.0;          //!< Вес интеграла модуля ошибки, умноженного на время
+    double overshootWeight = 0.0;     //!< Вес перерегулирования
+    double divergenceLimit = 100.0;   //!< Ошибка (в долях задания), после которой процесс считается расходящимся
+    bool earlyTermination = true;     //!< Прекращать оценку, когда стоимость превысила порог
+    std::size_t tableSize = 10;       //!< Количество строк итоговой таблицы
+};
+
+/**
+ * @brief Итог оценки набора коэффициентов
+ */
+enum class TuningStatus
+{
+    Completed, //!< Переходный процесс промоделирован полностью
+    Pruned,    //!< Оценка прекращена: стоимость превысила порог
+    Diverged   //!< Оценка прекращена: процесс расходится
+};
+
+/**
+ * @brief Строка таблицы результатов настройки
+ */
+struct TuningResult
+{
+    PidGains gains;                                       //!< Коэффициенты
+    double cost = std::numeric_limits<double>::infinity(); //!< Стоимость (для Pruned - нижняя граница)
+    double ise = 0.0;                                     //!< Интеграл квадрата ошибки
+    double itae = 0.0;                                    //!< Интеграл модуля ошибки, умноженного на время
+    double overshoot = 0.0;                               //!< Перерегулирование
+    TuningStatus status = TuningStatus::Completed;        //!< Итог оценки
+};
+
+namespace detail
+{
+/**
+ * @brief Порог отсечения: стоимость k-го лучшего завершённого кандидата
+ *
+ * Стоимость не убывает по ходу моделирования, поэтому кандидат, частичная
+ * стоимость которого превысила порог, заведомо не попадёт в k лучших, и его
+ * оценку можно прекратить. Порог читается потоками без блокировки.
+ */
+class CostThreshold
+{
+private:
+    std::size_t capacity;                  //!< Количество лучших стоимостей
+    std::priority_queue<double> best;      //!< Лучшие стоимости, наибольшая на вершине
+    std::mutex mtx;                        //!< Мьютекс очереди
+    std::atomic<double> bound{std::numeric_limits<double>::infinity()}; //!< Текущий порог
+
+public:
+    explicit CostThreshold(std::size_t count)
+        : capacity{count}
+    {
+    }
+
+    double get() const
+    {
+        return bound.load(std::memory_order_relaxed);
+    }
+
+    void add(double cost)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (best.size() < capacity)
+        {
+            best.push(cost);
+        }
+        else if (cost < best.top())
+        {
+            best.pop();
+            best.push(cost);
+        }
+        if (best.size() == capacity)
+        {
+            bound.store(best.top(), std::memory_order_relaxed);
+        }
+    }
+};
+}
+
+/**
+ * @brief Параллельный подбор коэффициентов ПИД-регулятора по модели объекта
+ *
+ * Каждый набор коэффициентов оценивается по переходному процессу замкнутого
+ * контура «PID - объект» на ступенчатое задание. Объект создаётся заново для
+ * каждой оценки вызовом plantFactory() и должен быть вызываемым объектом
+ * double(double control, double dt), возвращающим измеряемый выход.
+ *
+ * Оценка прекращается досрочно, если процесс расходится или частичная
+ * стоимость превысила порог, при котором кандидат уже не может попасть в
+ * результат. Наборы оцениваются на пуле потоков с перехватом работы, поэтому
+ * прекращённые досрочно оценки не оставляют потоки без работы.
+ *
+ * @tparam PlantFactory Тип функции, создающей модель объекта
+ */
+template <typename PlantFactory>
+class PidTuner
+{
+private:
+    PlantFactory plantFactory;               //!< Функция, создающая модель объекта
+    TuningOptions options;                   //!< Параметры оценки
+    ThreadPool pool;                         //!< Пул потоков
+    std::atomic<std::size_t> evaluations{0}; //!< Количество оценок
+    std::atomic<std::size_t> stopped{0};     //!< Количество досрочно прекращённых оценок
+    std::atomic<std::size_t> simulated{0};   //!< Количество промоделированных шагов
+
+public:
+    /**
+     * @brief Конструктор
+     *
+     * @param factory Функция, создающая модель объекта
+     * @param tuningOptions Параметры оценки
+     * @param threads Количество потоков; 0 - по числу аппаратных потоков
+     */
+    explicit PidTuner(PlantFactory factory, TuningOptions tuningOptions = {}, std::size_t threads = 0)
+        : plantFactory{std::move(factory)}, options{tuningOptions}, pool{threads}
+    {
+        if (!(options.dt > 0.0) || !(options.duration >= options.dt))
+        {
+            throw std::invalid_argument("Step size should be positive and not greater than duration");
+        }
+        if (options.reference == 0.0)
+        {
+            throw std::invalid_argument("Reference should not be zero");
+        }
+        if (options.tableSize == 0)
+        {
+            throw std::invalid_argument("Table size should be positive");
+        }
+    }
+
+    /**
+     * @brief Оценить один набор коэффициентов
+     *
+     * @param gains Коэффициенты
+     * @param bound Порог стоимости, после которого оценка прекращается
+     * @return Результат оценки
+     */
+    TuningResult evaluate(const PidGains& gains, double bound = std::numeric_limits<double>::infinity())
+    {
+        auto plant = plantFactory();
+        PID<double, NullMutex> pid(gains.p, gains.i, gains.d);
+
+        TuningResult result;
+        result.gains = gains;
+        if (!options.earlyTermination)
+        {
+            bound = std::numeric_limits<double>::infinity();
+        }
+
+        const double reference = options.reference;
+        const double limit = options.divergenceLimit * std::fabs(reference);
+        const auto steps = static_cast<std::size_t>(std::llround(options.duration / options.dt));
+        double output = 0.0;
+        double peak = 0.0;
+        double cost = 0.0;
+        std::size_t step = 0;
+        for (; step < steps; ++step)
+        {
+            const double time = static_cast<double>(step) * options.dt;
+            const double error = reference - output;
+            result.ise  += error * error * options.dt;
+            result.itae += time * std::fabs(error) * options.dt;
+
+            pid.step(error, options.dt);
+            output = plant(pid.getOutput(), options.dt);
+            peak = std::max(peak, (output - reference) / reference);
+            result.overshoot = peak;
+
+            cost = options.iseWeight * result.ise + options.itaeWeight * result.itae
+                 + options.overshootWeight * result.overshoot;
+            if (!std::isfinite(output) || std::fabs(reference - output) > limit)
+            {
+                result.status = TuningStatus::Diverged;
+                cost = std::numeric_limits<double>::infinity();
+                break;
+            }
+            if (cost > bound)
+            {
+                result.status = TuningStatus::Pruned;
+                break;
+            }
+        }
+
+        result.cost = cost;
+        ++evaluations;
+        simulated += std::min(step + 1, steps);
+        if (result.status != TuningStatus::Completed)
+        {
+            ++stopped;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Перебор всех сочетаний коэффициентов из сетки
+     *
+     * @return Таблица не более чем из tableSize лучших завершённых оценок по возрастанию стоимости
+     */
+    std::vector<TuningResult> gridSearch(const std::vector<double>& p,
+                                         const std::vector<double>& i,
+                                         const std::vector<double>& d)
+    {
+        const std::size_t count = p.size() * i.size() * d.size();
+        std::vector<TuningResult> results(count);
+        detail::CostThreshold threshold(options.tableSize);
+
+        pool.parallelFor(count, [&](std::size_t index, std::size_t)
+        {
+            const PidGains gains{p[index / (i.size() * d.size())],
+                                 i[index / d.size() % i.size()],
+                                 d[index % d.size()]};
+            results[index] = evaluate(gains, threshold.get());
+            if (results[index].status == TuningStatus::Completed)
+            {
+                threshold.add(results[index].cost);
+            }
+        });
+        return rank(std::move(results));
+    }
+
+    /**
+     * @brief Поиск методом Нелдера-Мида из нескольких начальных точек
+     *
+     * Начальные точки обрабатываются параллельно, каждая - своим симплексом
+     * с начальными приращениями step. Отрицательные коэффициенты заменяются
+     * нулём. Оценка кандидата прекращается, как только его стоимость превысила
+     * стоимость худшей вершины симплекса: такой кандидат отвергается при любом
+     * исходе сравнения, поэтому ход метода не меняется.
+     *
+     * @param starts Начальные точки
+     * @param step Начальные приращения коэффициентов
+     * @param iterations Наибольшее количество итераций для каждой точки
+     * @return Лучшие вершины симплексов по возрастанию стоимости
+     */
+    std::vector<TuningResult> nelderMead(const std::vector<PidGains>& starts,
+                                         const PidGains& step,
+                                         std::size_t iterations = 200)
+    {
+        std::vector<TuningResult> results(starts.size());
+        pool.parallelFor(starts.size(), [&](std::size_t index, std::size_t)
+        {
+            results[index] = simplexSearch(starts[index], step, iterations);
+        });
+        return rank(std::move(results));
+    }
+
+    /**
+     * @brief Количество оценок с момента создания
+     */
+    std::size_t evaluationCount() const
+    {
+        return evaluations.load();
+    }
+
+    /**
+     * @brief Количество оценок, прекращённых досрочно
+     */
+    std::size_t stoppedCount() const
+    {
+        return stopped.load();
+    }
+
+    /**
+     * @brief Количество промоделированных шагов во всех оценках
+     */
+    std::size_t simulatedSteps() const
+    {
+        return simulated.load();
+    }
+
+private:
+    using Point = std::array<double, 3>; //!< Коэффициенты как точка пространства поиска
+
+    static PidGains toGains(const Point& point)
+    {
+        return {std::max(point[0], 0.0), std::max(point[1], 0.0), std::max(point[2], 0.0)};
+    }
+
+    /**
+     * @brief Метод Нелдера-Мида для одной начальной точки
+     */
+    TuningResult simplexSearch(const PidGains& start, const PidGains& step, std::size_t iterations)
+    {
+        constexpr double reflection = 1.0;
+        constexpr double expansion = 2.0;
+        constexpr double contraction = 0.5;
+        constexpr double shrink = 0.5;
+        constexpr double tolerance = 1e-12;
+
+        std::array<Point, 4> points;
+        std::array<TuningResult, 4> values;
+        points[0] = {start.p, start.i, start.d};
+        const Point steps = {step.p, step.i, step.d};
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            points[k + 1] = points[0];
+            points[k + 1][k] += steps[k];
+        }
+        for (std::size_t k = 0; k < 4; ++k)
+        {
+            values[k] = evaluate(toGains(points[k]));
+        }
+
+        auto combine = [](const Point& from, const Point& to, double factor)
+        {
+            return Point{from[0] + factor * (to[0] - from[0]),
+                         from[1] + factor * (to[1] - from[1]),
+                         from[2] + factor * (to[2] - from[2])};
+        };
+
+        for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            std::array<std::size_t, 4> order = {0, 1, 2, 3};
+            std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b)
+            {
+                return values[a].cost < values[b].cost;
+            });
+            const std::size_t best = order[0];
+            const std::size_t secondWorst = order[2];
+            const std::size_t worst = order[3];
+            if (std::fabs(values[worst].cost - values[best].cost) <= tolerance * (std::fabs(values[best].cost) + tolerance))
+            {
+                break;
+            }
+
+            Point centroid = {0.0, 0.0, 0.0};
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                for (std::size_t axis = 0; axis < 3; ++axis)
+                {
+                    centroid[axis] += points[order[k]][axis] / 3.0;
+                }
+            }
+
+            const double worstCost = values[worst].cost;
+            const Point reflected = combine(centroid, points[worst], -reflection);
+            const TuningResult reflectedValue = evaluate(toGains(reflected), worstCost);
+            if (reflectedValue.cost < values[best].cost)
+            {
+                const Point expanded = combine(centroid, points[worst], -expansion);
+                const TuningResult expandedValue = evaluate(toGains(expanded), worstCost);
+                const bool useExpanded = expandedValue.cost < reflectedValue.cost;
+                points[worst] = useExpanded ? expanded : reflected;
+                values[worst] = useExpanded ? expandedValue : reflectedValue;
+                continue;
+            }
+            if (reflectedValue.cost < values[secondWorst].cost)
+            {
+                points[worst] = reflected;
+                values[worst] = reflectedValue;
+                continue;
+            }
+
+            const bool outside = reflectedValue.cost < worstCost;
+            const Point contracted = outside ? combine(centroid, reflected, contraction)
+                                             : combine(centroid, points[worst], contraction);
+            const TuningResult contractedValue = evaluate(toGains(contracted), worstCost);
+            if (contractedValue.cost < (outside ? reflectedValue.cost : worstCost))
+            {
+                points[worst] = contracted;
+                values[worst] = contractedValue;
+                continue;
+            }
+
+            for (std::size_t k = 1; k < 4; ++k)
+            {
+                points[order[k]] = combine(points[best], points[order[k]], shrink);
+                values[order[k]] = evaluate(toGains(points[order[k]]));
+            }
+        }
+
+        return *std::min_element(values.begin(), values.end(), [](const TuningResult& a, const TuningResult& b)
+        {
+            return a.cost < b.cost;
+        });
+    }
+
+    /**
+     * @brief Оставить tableSize лучших завершённых оценок по возрастанию стоимости
+     */
+    std::vector<TuningResult> rank(std::vector<TuningResult> results) const
+    {
+        results.erase(std::remove_if(results.begin(), results.end(), [](const TuningResult& result)
+        {
+            return result.status != TuningStatus::Completed;
+        }), results.end());
+
+        const std::size_t size = std::min(options.tableSize, results.size());
+        std::partial_sort(results.begin(), results.begin() + size, results.end(),
+                          [](const TuningResult& a, const TuningResult& b)
+        {
+            return a.cost < b.cost;
+        });
+        results.resize(size);
+        return results;
+    }
+};
+
+/**
+ * @brief Записать таблицу результатов в CSV-файл
+ *
+ * Столбцы: p, i, d, cost, ise, itae, overshoot; строки в порядке таблицы.
+ */
+inline void saveGainTable(const std::string& path, const std::vector<TuningResult>& table)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot create gain table " + path);
+    }
+
+    file.precision(17);
+    file << "p,i,d,cost,ise,itae,overshoot\n";
+    for (const TuningResult& result : table)
+    {
+        file << result.gains.p << ',' << result.gains.i << ',' << result.gains.d << ','
+             << result.cost << ',' << result.ise << ',' << result.itae << ',' << result.overshoot << '\n';
+    }
+    if (!file)
+    {
+        throw std::runtime_error("Cannot write gain table " + path);
+    }
+}
+
+/**
+ * @brief Прочитать коэффициенты из CSV-файла, записанного saveGainTable
+ *
+ * Строки, которые не удалось разобрать (заголовок), пропускаются.
+ *
+ * @return Коэффициенты в порядке таблицы (первая строка - лучшая)
+ */
+inline std::vector<PidGains> loadGainTable(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open gain table " + path);
+    }
+
+    std::vector<PidGains> table;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream stream(line);
+        PidGains gains;
+        if (stream >> gains.p >> gains.i >> gains.d)
+        {
+            table.push_back(gains);
+        }
+    }
+    return table;
+}
+}
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "../ThreadingPolicy.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Пул потоков с перехватом работы для параллельного цикла
+ *
+ * parallelFor(count, body) делит номера [0, count) на равные непрерывные
+ * диапазоны по числу потоков. Поток берёт номера из начала своего диапазона,
+ * а исчерпав его, забирает половину оставшихся номеров из конца диапазона
+ * другого потока. Поэтому задачи разной длительности (прогоны, завершённые
+ * досрочно) не оставляют потоки без работы, а обращения к общим данным
+ * происходят только при перехвате.
+ *
+ * Вызов parallelFor из тела цикла того же пула не допускается.
+ */
+class ThreadPool
+{
+public:
+    using Body = std::function<void(std::size_t index, std::size_t worker)>; //!< Тело цикла
+
+private:
+    /**
+     * @brief Диапазон номеров, принадлежащий потоку
+     */
+    struct alignas(64) Range
+    {
+        std::mutex mtx;        //!< Мьютекс диапазона
+        std::size_t begin = 0; //!< Первый невыполненный номер
+        std::size_t end = 0;   //!< Номер за последним
+    };
+
+    std::size_t workerCount;                //!< Количество потоков
+    std::unique_ptr<Range[]> ranges;        //!< Диапазоны потоков
+    std::vector<std::thread> threads;       //!< Рабочие потоки
+    std::mutex submitMtx;                   //!< Последовательное выполнение вызовов parallelFor
+    std::mutex mtx;                         //!< Мьютекс состояния задания
+    std::condition_variable cv;             //!< Оповещение о начале и завершении задания
+    const Body* body = nullptr;             //!< Тело текущего цикла
+    std::uint64_t generation = 0;           //!< Номер текущего задания
+    std::size_t active = 0;                 //!< Количество потоков, не завершивших задание
+    bool stopping = false;                  //!< Запрошено ли завершение потоков
+    std::exception_ptr error;               //!< Первое исключение тела цикла
+    std::atomic<bool> cancelled{false};     //!< Отменены ли невыполненные номера текущего задания
+    std::atomic<std::uint64_t> steals{0};   //!< Количество перехватов работы
+
+public:
+    /**
+     * @brief Конструктор пула
+     *
+     * @param threadCount Количество потоков; 0 - по числу аппаратных потоков
+     */
+    explicit ThreadPool(std::size_t threadCount = 0)
+    {
+        if (threadCount == 0)
+        {
+            threadCount = std::thread::hardware_concurrency();
+        }
+        if (threadCount == 0)
+        {
+            threadCount = 1;
+        }
+
+        workerCount = threadCount;
+        ranges = std::make_unique<Range[]>(threadCount);
+        threads.reserve(threadCount);
+        for (std::size_t worker = 0; worker < threadCount; ++worker)
+        {
+            threads.emplace_back([this, worker] { run(worker); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Количество потоков пула
+     */
+    std::size_t size() const
+    {
+        return workerCount;
+    }
+
+    /**
+     * @brief Количество перехватов работы с момента создания пула
+     */
+    std::uint64_t stealCount() const
+    {
+        return steals.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Выполнить body(index, worker) для каждого index из [0, count)
+     *
+     * Возвращает управление после выполнения всех номеров. Если тело цикла
+     * выбросило исключение, невыполненные номера отменяются, а первое
+     * исключение передаётся вызывающему потоку.
+     *
+     * @param count Количество номеров
+     * @param loopBody Тело цикла; worker - номер потока в [0, size())
+     */
+    void parallelFor(std::size_t count, const Body& loopBody)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(submitMtx);
+        cancelled.store(false);
+        const std::size_t workers = workerCount;
+        for (std::size_t worker = 0; worker < workers; ++worker)
+        {
+            std::lock_guard<std::mutex> lock(ranges[worker].mtx);
+            ranges[worker].begin = count * worker / workers;
+            ranges[worker].end   = count * (worker + 1) / workers;
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        body   = &loopBody;
+        active = workers;
+        error  = nullptr;
+        ++generation;
+        cv.notify_all();
+        cv.wait(lock, [this] { return active == 0; });
+
+        body = nullptr;
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    /**
+     * @brief Цикл рабочего потока
+     */
+    void run(std::size_t worker)
+    {
+        std::uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true)
+        {
+            cv.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+            {
+                return;
+            }
+            seen = generation;
+            const Body& job = *body;
+            lock.unlock();
+
+            try
+            {
+                std::size_t index;
+                while (next(worker, index))
+                {
+                    job(index, worker);
+                }
+            }
+            catch (...)
+            {
+                cancel();
+                std::lock_guard<std::mutex> errorLock(mtx);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            lock.lock();
+            if (--active == 0)
+            {
+                cv.notify_all();
+            }
+        }
+    }
+
+    /**
+     * @brief Следующий номер для потока: из своего диапазона или перехваченный
+     */
+    bool next(std::size_t worker, std::size_t& index)
+    {
+        {
+            std::lock_guard<std::mutex> lock(ranges[worker].mtx);
+            if (ranges[worker].begin < ranges[worker].end)
+            {
+                index = ranges[worker].begin++;
+                return true;
+            }
+        }
+
+        const std::size_t workers = workerCount;
+        for (std::size_t offset = 1; offset < workers; ++offset)
+        {
+            Range& victim = ranges[(worker + offset) % workers];
+            std::size_t first;
+            std::size_t last;
+            {
+                std::lock_guard<std::mutex> lock(victim.mtx);
+                const std::size_t remaining = victim.end - victim.begin;
+                if (remaining == 0)
+                {
+                    continue;
+                }
+                last       = victim.end;
+                first      = victim.end - (remaining + 1) / 2;
+                victim.end = first;
+            }
+
+            // Отмена могла пройти по диапазонам, пока перехваченные номера были
+            // ни у кого; флаг проверяется под мьютексом своего диапазона, который
+            // cancel() захватывает после установки флага
+            std::lock_guard<std::mutex> lock(ranges[worker].mtx);
+            if (cancelled.load())
+            {
+                return false;
+            }
+            steals.fetch_add(1, std::memory_order_relaxed);
+            ranges[worker].begin = first + 1;
+            ranges[worker].end   = last;
+            index = first;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Отменить невыполненные номера всех потоков
+     */
+    void cancel()
+    {
+        cancelled.store(true);
+        for (std::size_t worker = 0; worker < workerCount; ++worker)
+        {
+            std::lock_guard<std::mutex> lock(ranges[worker].mtx);
+            ranges[worker].begin = ranges[worker].end;
+        }
+    }
+};
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Направление пересечения нуля
+ */
+enum class CrossingDirection
+{
+    Rising,  //!< Из отрицательного значения в неотрицательное
+    Falling, //!< Из положительного значения в неположительное
+    Either   //!< В любом направлении
+};
+
+namespace detail
+{
+/**
+ * @brief Пересекает ли сигнал ноль между двумя значениями
+ *
+ * Значение, равное нулю в начале интервала, пересечением не считается,
+ * поэтому событие, найденное в момент t, не обнаруживается повторно на
+ * следующем шаге.
+ *
+ * @param before Значение в начале интервала
+ * @param after Значение в конце интервала
+ * @param direction Направление пересечения
+ */
+template <typename T>
+bool crossesZero(T before, T after, CrossingDirection direction)
+{
+    const bool rising  = before < T(0) && after >= T(0);
+    const bool falling = before > T(0) && after <= T(0);
+    switch (direction)
+    {
+    case CrossingDirection::Rising:
+        return rising;
+    case CrossingDirection::Falling:
+        return falling;
+    case CrossingDirection::Either:
+        break;
+    }
+    return rising || falling;
+}
+
+/**
+ * @brief Уточнить момент пересечения нуля методом Иллинойс
+ *
+ * Метод ложного положения, в котором значение на конце отрезка, не
+ * менявшемся два шага подряд, делится пополам; сходимость сверхлинейная,
+ * а отрезок всегда содержит пересечение. Возвращается правый конец отрезка,
+ * то есть момент, в котором сигнал уже пересёк ноль.
+ *
+ * @param g Функция g(t)
+ * @param a Начало отрезка, где значение ещё не пересекло ноль
+ * @param ga Значение в a
+ * @param b Конец отрезка, где значение уже пересекло ноль
+ * @param gb Значение в b
+ * @param tolerance Допустимая длина итогового отрезка
+ * @param maxIterations Наибольшее количество вычислений g
+ */
+template <typename T, typename Function>
+T locateZeroCrossing(Function&& g, T a, T ga, T b, T gb, T tolerance, std::size_t maxIterations = 100)
+{
+    const bool rising = ga < T(0);
+    int retained = 0; // Какой конец сохранился на прошлой итерации: -1 - левый, 1 - правый
+    for (std::size_t iteration = 0; iteration < maxIterations && b - a > tolerance; ++iteration)
+    {
+        T c = (a * gb - b * ga) / (gb - ga);
+        if (!(c > a && c < b))
+        {
+            c = a + (b - a) / 2;
+        }
+
+        const T gc = g(c);
+        const bool crossed = rising ? gc >= T(0) : gc <= T(0);
+        if (crossed)
+        {
+            b  = c;
+            gb = gc;
+            if (retained == -1)
+            {
+                ga /= 2;
+            }
+            retained = -1;
+        }
+        else
+        {
+            a  = c;
+            ga = gc;
+            if (retained == 1)
+            {
+                gb /= 2;
+            }
+            retained = 1;
+        }
+    }
+    return b;
+}
+}
+}
@@ -5,17 +5,38 @@
 #include <random>
 
 #include "Utils.hpp"
+#include "Checkpoint.hpp"
+#include "FixedPoint.hpp"
+#include "ThreadingPolicy.hpp"
+#include "Philox.hpp"
 
 #include "IntegratorBlock.hpp"
+#include "IntegratorBank.hpp"
 #include "DerivativeBlock.hpp"
+#include "DiscreteStateSpace.hpp"
+#include "DiscreteTransferFcn.hpp"
 #include "LookupTable1D.hpp"
+#include "LookupTableND.hpp"
+#include "MappedLookupTable1D.hpp"
 #include "TriggeredSubsystem.hpp"
+#include "ConditionalSubsystem.hpp"
 #include "RandomNumberGenerator.hpp"
 #include "WhiteNoiseGenerator.hpp"
+#include "BandLimitedWhiteNoise.hpp"
 #include "SaturationBlock.hpp"
 #include "SineWaveGenerator.hpp"
 #include "RateLimiter.hpp"
 #include "PID.hpp"
+#include "PIDBank.hpp"
+#include "Chain.hpp"
+
+#include "Simulation/Model.hpp"
+#include "Simulation/ContinuousModel.hpp"
+#include "Simulation/EventQueue.hpp"
+#include "Simulation/ZeroCrossing.hpp"
+#include "Simulation/MultiRateScheduler.hpp"
+#include "Simulation/MonteCarloRunner.hpp"
+#include "Simulation/PidTuner.hpp"
 
 #include "FlightControllers/LateralControl.hpp"
 #include "FlightControllers/LongitudalControl.hpp"
@@ -1,27 +1,58 @@
 #pragma once
 
+#include "MathKernels.hpp"
+#include "Checkpoint.hpp"
+#include "ThreadingPolicy.hpp"
+
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
+#include <stdexcept>
 
 namespace SimulinkBlock
 {
 /**
  * @brief Класс генератора синусоидного сигнала
  *
+ * Кроме вычисления по абсолютному времени (step(time)) поддерживается режим
+ * с постоянным шагом (setFixedStep и step()): отсчёт получается поворотом
+ * вектора (cos, sin) на угол 2*pi*frequency*dt, что требует нескольких
+ * умножений и сложений. Фаза начала каждого блока из resyncInterval шагов
+ * накапливается в периодах в диапазоне [0, 1) с компенсацией Кэхэна, и
+ * вектор пересчитывается по ней, поэтому ошибка поворота не накапливается,
+ * а точность не падает с ростом времени моделирования.
+ *
  * @tparam T Тип выходного значения
  * @tparam U Тип параметров синусоиды
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T, typename U>
+template <typename T, typename U, typename Mutex = std::mutex>
 class SineWaveGenerator
 {
 private:
-    std::mutex mtx;  //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx;       //!< Мьютекс для блокировки одновременного доступа к переменным класса
     U amplitude;     //!< Амплитуда синусоиды
     U frequency;     //!< Частота синусоиды
     U phase;         //!< Сдвиг фазы синусоиды
     T output = T(0); //!< Выходное значение
 
+    bool fixedStep = false;          //!< Включён ли режим с постоянным шагом
+    U sampleTime = U(0);             //!< Постоянный шаг по времени
+    U startTime = U(0);              //!< Время первого отсчёта
+    std::uint64_t stepCount = 0;     //!< Количество выполненных шагов
+    std::uint32_t blockStep = 0;     //!< Номер шага внутри текущего блока
+    U cyclesPerBlock = U(0);         //!< Приращение фазы за блок в периодах (дробная часть)
+    U blockPhase = U(0);             //!< Фаза начала текущего блока в периодах
+    U blockPhaseError = U(0);        //!< Компенсация ошибки округления накопленной фазы
+    U rotationCos = U(1);            //!< Косинус угла поворота за один шаг
+    U rotationSin = U(0);            //!< Синус угла поворота за один шаг
+    U stateCos = U(1);               //!< Косинус текущей фазы
+    U stateSin = U(0);               //!< Синус текущей фазы
+
 public:
+    static constexpr std::uint32_t resyncInterval = 1024; //!< Количество шагов между пересчётами вектора по фазе
+
     /**
     * @brief Конструктор класса SineWaveGenerator
     *
@@ -41,10 +72,51 @@ public:
     */
     void step(U time)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         output = static_cast<T>(amplitude * sin(2 * M_PI * frequency * time + phase));
     }
 
+    /**
+    * @brief Заполнить буфер отсчётами синусоиды с постоянным шагом
+    *
+    * Отсчёт i соответствует моменту t0 + i * dt. Фаза каждого отсчёта
+    * вычисляется независимо по его номеру, а синус - многочленом
+    * detail::sinCycles, поэтому цикл векторизуется, а ошибка не накапливается.
+    * Выход блока и состояние режима с постоянным шагом не изменяются.
+    *
+    * @param t0 Время первого отсчёта
+    * @param dt Шаг по времени
+    * @param out Указатель на буфер из count отсчётов
+    * @param count Количество отсчётов
+    */
+    void generate(U t0, U dt, T* out, std::size_t count)
+    {
+        U amp, freq, ph;
+        {
+            std::lock_guard<Mutex> lock(mtx);
+            amp  = amplitude;
+            freq = frequency;
+            ph   = phase;
+        }
+
+        const U startCycles   = fraction(freq * t0 + ph / U(2 * M_PI));
+        const U cyclesPerStep = fraction(freq * dt);
+
+        // Номер отсчёта внутри пачки помещается в int, преобразование которого
+        // в число с плавающей точкой векторизуется (в отличие от std::size_t)
+        constexpr std::size_t chunk = std::size_t(1) << 16;
+        for (std::size_t first = 0; first < count; first += chunk)
+        {
+            const U chunkCycles = fraction(startCycles + static_cast<U>(first) * cyclesPerStep);
+            const int length    = static_cast<int>(count - first < chunk ? count - first : chunk);
+            T* __restrict chunkOut = out + first;
+            for (int i = 0; i < length; ++i)
+            {
+                chunkOut[i] = static_cast<T>(amp * detail::sinCycles(chunkCycles + static_cast<U>(i) * cyclesPerStep));
+            }
+        }
+    }
+
     /**
     * @brief Настроить параметры генератора синусоиды
     *
@@ -54,10 +126,58 @@ public:
     */
     void setup(U amp, U freq, U ph)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         amplitude = amp;
         frequency = freq;
         phase     = ph;
+
+        if (fixedStep)
+        {
+            restart(startTime + static_cast<U>(stepCount) * sampleTime);
+        }
+    }
+
+    /**
+    * @brief Включить режим генерации с постоянным шагом
+    *
+    * Первый вызов step() без аргументов выдаёт отсчёт для момента startT,
+    * каждый следующий - для момента, большего на dt.
+    *
+    * @param dt Постоянный шаг по времени
+    * @param startT Время первого отсчёта
+    */
+    void setFixedStep(U dt, U startT = U(0))
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        fixedStep  = true;
+        sampleTime = dt;
+        startTime  = startT;
+        stepCount  = 0;
+        restart(startT);
+    }
+
+    /**
+    * @brief Выполнить один шаг генерации в режиме с постоянным шагом
+    */
+    void step()
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        if (!fixedStep)
+        {
+            throw std::logic_error("Fixed step is not set");
+        }
+
+        output = static_cast<T>(amplitude * stateSin);
+
+        const U nextCos = stateCos * rotationCos - stateSin * rotationSin;
+        stateSin        = stateSin * rotationCos + stateCos * rotationSin;
+        stateCos        = nextCos;
+
+        ++stepCount;
+        if (++blockStep == resyncInterval)
+        {
+            resync();
+        }
     }
 
     /**
@@ -67,7 +187,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -76,11 +196,82 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         amplitude = U(1);
         frequency = U(1);
         phase     = U(0);
         output    = U(0);
+        fixedStep = false;
+    }
+
+    /**
+     * @brief Записать состояние генератора в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+        out.write(stepCount);
+        out.write(blockStep);
+        out.write(blockPhase);
+        out.write(blockPhaseError);
+        out.write(stateCos);
+        out.write(stateSin);
+    }
+
+    /**
+     * @brief Восстановить состояние генератора из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+        in.read(stepCount);
+        in.read(blockStep);
+        in.read(blockPhase);
+        in.read(blockPhaseError);
+        in.read(stateCos);
+        in.read(stateSin);
+    }
+
+private:
+    /**
+     * @brief Дробная часть числа
+     */
+    static U fraction(U value)
+    {
+        return value - std::floor(value);
+    }
+
+    /**
+     * @brief Начать режим с постоянным шагом с заданного момента времени
+     */
+    void restart(U time)
+    {
+        const U cyclesPerStep = frequency * sampleTime;
+        // resyncInterval - степень двойки, поэтому произведение вычисляется точно
+        cyclesPerBlock  = fraction(static_cast<U>(resyncInterval) * cyclesPerStep);
+        rotationCos     = std::cos(U(2 * M_PI) * fraction(cyclesPerStep));
+        rotationSin     = std::sin(U(2 * M_PI) * fraction(cyclesPerStep));
+        blockPhase      = fraction(frequency * time + phase / U(2 * M_PI));
+        blockPhaseError = U(0);
+        blockStep       = 0;
+        stateCos        = std::cos(U(2 * M_PI) * blockPhase);
+        stateSin        = std::sin(U(2 * M_PI) * blockPhase);
+    }
+
+    /**
+     * @brief Перейти к следующему блоку и пересчитать вектор по накопленной фазе
+     */
+    void resync()
+    {
+        const U increment = cyclesPerBlock - blockPhaseError;
+        const U sum       = blockPhase + increment;
+        blockPhaseError   = (sum - blockPhase) - increment;
+        blockPhase        = fraction(sum);
+        blockStep         = 0;
+        stateCos          = std::cos(U(2 * M_PI) * blockPhase);
+        stateSin          = std::sin(U(2 * M_PI) * blockPhase);
     }
 };
 }
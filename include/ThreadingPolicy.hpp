@@ -0,0 +1,57 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+
+namespace SimulinkBlock
+{
+/**
+ * @brief Политика синхронизации без блокировок
+ *
+ * Используется в качестве параметра шаблона Mutex для блоков, которые
+ * принадлежат одному потоку. Все операции вырождаются в пустые вызовы,
+ * поэтому шаг блока компилируется без синхронизации.
+ */
+struct NullMutex
+{
+    void lock() noexcept {}
+    bool try_lock() noexcept { return true; }
+    void unlock() noexcept {}
+};
+
+/**
+ * @brief Политика синхронизации на основе спин-блокировки
+ *
+ * Подходит для коротких критических секций (шаг блока), когда
+ * конкуренция между потоками низкая. Занимает один байт вместо
+ * 40 байт std::mutex.
+ */
+class SpinMutex
+{
+private:
+    std::atomic_flag flag = ATOMIC_FLAG_INIT; //!< Признак захвата блокировки
+
+public:
+    SpinMutex() = default;
+    SpinMutex(const SpinMutex&) = delete;
+    SpinMutex& operator=(const SpinMutex&) = delete;
+
+    void lock() noexcept
+    {
+        while (flag.test_and_set(std::memory_order_acquire))
+        {
+        }
+    }
+
+    bool try_lock() noexcept
+    {
+        return !flag.test_and_set(std::memory_order_acquire);
+    }
+
+    void unlock() noexcept
+    {
+        flag.clear(std::memory_order_release);
+    }
+};
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "ThreadingPolicy.hpp"
+#include "Checkpoint.hpp"
+
 #include <mutex>
 namespace SimulinkBlock
 {
@@ -8,12 +11,13 @@ namespace SimulinkBlock
  *
  * @tparam T Тип входных данных
  * @tparam U Тип триггера
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
  */
-template <typename T, typename U>
+template <typename T, typename U, typename Mutex = std::mutex>
 class TriggeredSubsystem
 {
 private:
-    std::mutex mtx;         //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Mutex mtx;              //!< Мьютекс для блокировки одновременного доступа к переменным класса
     T output        = T(0); //!< Внешний выход
     U prev_state    = U(0); //!< Предыдущие состояния нулевых переходов (триггер)
 
@@ -26,7 +30,7 @@ public:
      */
     void step(const T& input, const U& trigger_input)
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         // Проверка условия триггера и предыдущего состояния нулевого перехода
         if ( trigger_input && ( prev_state != static_cast<T>(1) ) )
         {
@@ -45,7 +49,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -54,9 +58,29 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         prev_state = T(0);
         output     = U(0);
     }
+
+    /**
+     * @brief Записать состояние подсистемы в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        out.write(output);
+        out.write(prev_state);
+    }
+
+    /**
+     * @brief Восстановить состояние подсистемы из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        in.read(output);
+        in.read(prev_state);
+    }
 };
 }
@@ -1,22 +1,87 @@
 #pragma once
 
+#include "MathKernels.hpp"
+#include "Checkpoint.hpp"
+#include "Philox.hpp"
+#include "ThreadingPolicy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <mutex>
 #include <random>
 
 
 namespace SimulinkBlock
 {
+namespace detail
+{
 /**
- * @brief Шаблон класса для генерации белого шума типа T
+ * @brief Преобразование Бокса-Мюллера для массивов равномерных чисел
+ *
+ * Из пары u1 в (0, 1] и u2 в [0, 1) получаются два независимых нормальных
+ * числа mean + stddev * sqrt(-2 ln u1) * (cos, sin)(2 pi u2). Логарифм и синус
+ * вычисляются многочленами без ветвлений (logPositive, sinCycles), поэтому
+ * первый и третий циклы векторизуются компилятором; корень вынесен в
+ * отдельный цикл, так как проверка errno в std::sqrt мешает векторизации.
+ *
+ * @param u1 Равномерные числа в (0, 1], используются как рабочий массив
+ * @param u2 Равномерные числа в [0, 1)
+ * @param out Выходной массив из 2 * pairs значений
+ * @param pairs Количество пар
  */
 template <typename T>
+void boxMuller(double* __restrict u1,
+               const double* __restrict u2,
+               T* __restrict out,
+               std::size_t pairs,
+               double mean,
+               double stddev)
+{
+    for (std::size_t i = 0; i < pairs; ++i)
+    {
+        u1[i] = -2.0 * logPositive(u1[i]);
+    }
+    for (std::size_t i = 0; i < pairs; ++i)
+    {
+        u1[i] = stddev * std::sqrt(u1[i]);
+    }
+    for (std::size_t i = 0; i < pairs; ++i)
+    {
+        out[2 * i]     = static_cast<T>(mean + u1[i] * sinCycles(u2[i] + 0.25));
+        out[2 * i + 1] = static_cast<T>(mean + u1[i] * sinCycles(u2[i]));
+    }
+}
+}
+
+/**
+ * @brief Шаблон класса для генерации белого шума типа T
+ *
+ * Нормальные числа вычисляются пачками преобразованием Бокса-Мюллера
+ * (detail::boxMuller). step() берёт значения из внутреннего буфера на
+ * prefetchSize отсчётов и обращается к генератору только при его опустошении;
+ * fill() заполняет массив пользователя напрямую.
+ *
+ * @tparam Mutex Политика синхронизации доступа (std::mutex, SpinMutex или NullMutex)
+ * @tparam Engine Генератор случайных битов (std::mt19937, Philox4x32 и т.п.)
+ */
+template <typename T, typename Mutex = std::mutex, typename Engine = std::mt19937>
 class WhiteNoiseGenerator
 {
 private:
-    std::mutex mtx;                           //!< Мьютекс для блокировки одновременного доступа к переменным класса
-    std::mt19937 generator;                   //!< Генератор случайных чисел Mersenne Twister
-    std::normal_distribution<T> distribution; //!< Нормальное распределение для генерации белого шума
-    T output = T(0);                          //!< Переменная для хранения сгенерированного значения белого шума
+    static constexpr std::size_t chunkPairs = 128; //!< Количество пар, преобразуемых за один проход
+
+public:
+    static constexpr std::size_t prefetchSize = 64; //!< Размер буфера заранее вычисленных отсчётов
+
+private:
+    Mutex mtx;                           //!< Мьютекс для блокировки одновременного доступа к переменным класса
+    Engine generator;                    //!< Генератор случайных битов
+    T mean;                              //!< Математическое ожидание
+    T stddev;                            //!< Среднеквадратическое отклонение
+    std::array<T, prefetchSize> buffer;  //!< Заранее вычисленные отсчёты
+    std::size_t position = prefetchSize; //!< Номер следующего отсчёта в буфере
+    T output = T(0);                     //!< Переменная для хранения сгенерированного значения белого шума
 
 public:
     /**
@@ -24,7 +89,20 @@ public:
      */
     WhiteNoiseGenerator(T mean, T stddev)
         : generator(std::random_device()()),
-        distribution(mean, stddev)
+        mean{mean}, stddev{stddev}
+    {
+    }
+
+    /**
+     * @brief Конструктор с заданным генератором для воспроизводимых последовательностей
+     *
+     * @param mean Математическое ожидание
+     * @param stddev Среднеквадратическое отклонение
+     * @param engine Генератор случайных битов, например Philox4x32(seed, stream)
+     */
+    WhiteNoiseGenerator(T mean, T stddev, const Engine& engine)
+        : generator(engine),
+        mean{mean}, stddev{stddev}
     {
     }
 
@@ -33,8 +111,27 @@ public:
      */
     void step()
     {
-        std::lock_guard<std::mutex> lock(mtx);
-        output = distribution(generator);
+        std::lock_guard<Mutex> lock(mtx);
+        if (position == prefetchSize)
+        {
+            generate(buffer.data(), prefetchSize);
+            position = 0;
+        }
+        output = buffer[position++];
+    }
+
+    /**
+     * @brief Заполнить массив отсчётами белого шума
+     *
+     * Выход блока и буфер step() не изменяются.
+     *
+     * @param out Указатель на count отсчётов
+     * @param count Количество отсчётов
+     */
+    void fill(T* out, std::size_t count)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        generate(out, count);
     }
 
     /**
@@ -44,7 +141,7 @@ public:
      */
     const T& getOutput()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         return output;
     }
 
@@ -53,8 +150,71 @@ public:
      */
     void reset()
     {
-        std::lock_guard<std::mutex> lock(mtx);
+        std::lock_guard<Mutex> lock(mtx);
         output = T(0);
     }
+
+    /**
+     * @brief Записать состояние блока в контрольную точку
+     */
+    void saveState(StateWriter& out)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        detail::saveEngine(out, generator);
+        out.write(buffer);
+        out.write(static_cast<std::uint64_t>(position));
+        out.write(output);
+    }
+
+    /**
+     * @brief Восстановить состояние блока из контрольной точки
+     */
+    void restoreState(StateReader& in)
+    {
+        std::lock_guard<Mutex> lock(mtx);
+        detail::restoreEngine(in, generator);
+        in.read(buffer);
+        const std::uint64_t restoredPosition = in.read<std::uint64_t>();
+        if (restoredPosition > prefetchSize)
+        {
+            throw std::invalid_argument("Checkpoint does not match the object layout");
+        }
+        position = static_cast<std::size_t>(restoredPosition);
+        in.read(output);
+    }
+
+private:
+    /**
+     * @brief Вычислить count нормальных отсчётов пачками по chunkPairs пар
+     */
+    void generate(T* out, std::size_t count)
+    {
+        std::array<double, chunkPairs> u1;
+        std::array<double, chunkPairs> u2;
+        std::array<T, 2> tail;
+
+        while (count > 0)
+        {
+            const std::size_t pairs = std::min(chunkPairs, (count + 1) / 2);
+            for (std::size_t i = 0; i < pairs; ++i)
+            {
+                u1[i] = 1.0 - std::generate_canonical<double, 53>(generator);
+                u2[i] = std::generate_canonical<double, 53>(generator);
+            }
+
+            // При нечётном остатке последняя пара вычисляется во временный массив
+            const std::size_t fullPairs = std::min(pairs, count / 2);
+            detail::boxMuller(u1.data(), u2.data(), out, fullPairs, mean, stddev);
+            if (fullPairs < pairs)
+            {
+                detail::boxMuller(u1.data() + fullPairs, u2.data() + fullPairs, tail.data(), 1, mean, stddev);
+                out[2 * fullPairs] = tail[0];
+            }
+
+            const std::size_t written = std::min(count, 2 * pairs);
+            out   += written;
+            count -= written;
+        }
+    }
 };
 }
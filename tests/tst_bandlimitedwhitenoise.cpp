@@ -0,0 +1,95 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../include/BandLimitedWhiteNoise.hpp"
+
+using namespace SimulinkBlock;
+
+
+// Проверка выходных данных после инициализации и сброса
+TEST(BandLimitedWhiteNoise, DefaultAndReset)
+{
+    BandLimitedWhiteNoise<double> noise(0.1, 0.01);
+    EXPECT_EQ(noise.getOutput(), 0.0);
+
+    noise.step(0.0);
+    noise.reset();
+    EXPECT_EQ(noise.getOutput(), 0.0);
+}
+
+// Значение удерживается в течение интервала и меняется на его границе
+TEST(BandLimitedWhiteNoise, HoldsForSampleTime)
+{
+    BandLimitedWhiteNoise<double, NullMutex, Philox4x32> noise(0.1, 0.01, Philox4x32(1));
+
+    const double dt = 0.001;
+    double previous = 0.0;
+    for (int i = 0; i < 1000; i++)
+    {
+        noise.step(i * dt);
+        if (i % 10 == 0)
+        {
+            EXPECT_NE(noise.getOutput(), previous) << "step " << i;
+        }
+        else
+        {
+            EXPECT_EQ(noise.getOutput(), previous) << "step " << i;
+        }
+        previous = noise.getOutput();
+    }
+
+    // 1000 шагов решателя по 10 шагов на интервал
+    EXPECT_EQ(noise.getDrawCount(), 100u);
+}
+
+// Выход не зависит от шага решателя
+TEST(BandLimitedWhiteNoise, IndependentOfSolverStep)
+{
+    BandLimitedWhiteNoise<double, NullMutex, Philox4x32> fine(1.0, 0.1, Philox4x32(9), 16);
+    BandLimitedWhiteNoise<double, NullMutex, Philox4x32> coarse(1.0, 0.1, Philox4x32(9), 64);
+
+    for (int i = 0; i < 3000; i++)
+    {
+        fine.step(i * 0.01);
+        if (i % 30 == 0)
+        {
+            coarse.step(i * 0.01);
+            EXPECT_EQ(coarse.getOutput(), fine.getOutput()) << "step " << i;
+        }
+    }
+    EXPECT_EQ(fine.getDrawCount(), 300u);
+    EXPECT_EQ(coarse.getDrawCount(), 298u);
+}
+
+// Дисперсия удерживаемых значений равна noisePower / sampleTime
+TEST(BandLimitedWhiteNoise, Variance)
+{
+    const double noisePower = 0.02;
+    const double sampleTime = 0.005;
+    BandLimitedWhiteNoise<double, NullMutex, Philox4x32> noise(noisePower, sampleTime, Philox4x32(3));
+
+    const int samples = 100000;
+    double sum = 0.0;
+    double squares = 0.0;
+    for (int k = 0; k < samples; k++)
+    {
+        noise.step((k + 0.5) * sampleTime);
+        sum += noise.getOutput();
+        squares += noise.getOutput() * noise.getOutput();
+    }
+
+    const double variance = noisePower / sampleTime;
+    EXPECT_NEAR(sum / samples, 0.0, 5 * std::sqrt(variance / samples));
+    EXPECT_NEAR(squares / samples, variance, 5 * variance * std::sqrt(2.0 / samples));
+}
+
+// Неверные параметры
+TEST(BandLimitedWhiteNoise, InvalidArguments)
+{
+    EXPECT_THROW(BandLimitedWhiteNoise<double>(0.1, 0.0), std::invalid_argument);
+    EXPECT_THROW(BandLimitedWhiteNoise<double>(-0.1, 0.01), std::invalid_argument);
+    EXPECT_THROW(BandLimitedWhiteNoise<double>(0.1, 0.01, 0), std::invalid_argument);
+}
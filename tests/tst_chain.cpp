@@ -0,0 +1,76 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include "../include/Chain.hpp"
+#include "../include/DerivativeBlock.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/LookupTable1D.hpp"
+#include "../include/RateLimiter.hpp"
+#include "../include/SaturationBlock.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Цепочка даёт тот же результат, что и последовательные вызовы step()
+TEST(Chain, MatchesSequentialSteps)
+{
+    IntegratorBlock<double, NullMutex> integrator;
+    SaturationBlock<double, NullMutex> saturation{-1, 1};
+    RateLimiter<double, NullMutex> rateLimiter{0.5, -0.5};
+    auto fused = chain(integrator, saturation, rateLimiter);
+    EXPECT_EQ(fused.size(), 3u);
+
+    IntegratorBlock<double> referenceIntegrator;
+    SaturationBlock<double> referenceSaturation{-1, 1};
+    RateLimiter<double> referenceRateLimiter{0.5, -0.5};
+
+    const double dt = 0.01;
+    for (int i = 0; i < 2000; i++)
+    {
+        const double input = std::sin(0.005 * i) * 3;
+        const double output = fused.step(input, dt);
+
+        referenceIntegrator.step(input, dt);
+        referenceSaturation.step(referenceIntegrator.getOutput());
+        referenceRateLimiter.step(referenceSaturation.getOutput(), dt);
+
+        EXPECT_DOUBLE_EQ(output, referenceRateLimiter.getOutput());
+        EXPECT_DOUBLE_EQ(integrator.getOutput(), referenceIntegrator.getOutput());
+        EXPECT_DOUBLE_EQ(rateLimiter.getOutput(), referenceRateLimiter.getOutput());
+    }
+}
+
+// Блоки с шагом dt и без него, таблица с подсказкой отрезка
+TEST(Chain, MixedBlocks)
+{
+    LookupTable1D<double, 3> table({0, 1, 3}, {0, 10, 40});
+    table.enableSegmentHint(true);
+    DerivativeBlock<double, NullMutex> derivative;
+    SaturationBlock<double, NullMutex> saturation{-12, 12};
+    auto fused = chain(table, derivative, saturation);
+
+    EXPECT_DOUBLE_EQ(fused.step(0.5, 0.5), 10);
+    EXPECT_DOUBLE_EQ(fused.step(1.0, 0.5), 10);
+    EXPECT_DOUBLE_EQ(fused.step(1.5, 0.5), 12);
+    EXPECT_DOUBLE_EQ(fused.step(1.5, 0.5), 0);
+    EXPECT_EQ(table.getSegmentHint().hits + table.getSegmentHint().misses, 4u);
+
+    // Выход блока без собственного состояния цепочкой не изменяется
+    EXPECT_DOUBLE_EQ(saturation.getOutput(), 0);
+}
+
+// Цепочка из одного блока
+TEST(Chain, SingleBlock)
+{
+    IntegratorBlock<float, SpinMutex> integrator(-1.0f, 1.0f);
+    auto fused = chain(integrator);
+    for (int i = 0; i < 20; i++)
+    {
+        fused.step(1.0f, 0.1f);
+    }
+    EXPECT_FLOAT_EQ(integrator.getOutput(), 1.0f);
+}
@@ -0,0 +1,302 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../include/BandLimitedWhiteNoise.hpp"
+#include "../include/Checkpoint.hpp"
+#include "../include/DerivativeBlock.hpp"
+#include "../include/FlightControllers/LateralControl.hpp"
+#include "../include/FlightControllers/LongitudalControl.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/LookupTable1D.hpp"
+#include "../include/LookupTableND.hpp"
+#include "../include/MappedLookupTable1D.hpp"
+#include "../include/PID.hpp"
+#include "../include/PIDBank.hpp"
+#include "../include/Philox.hpp"
+#include "../include/RandomNumberGenerator.hpp"
+#include "../include/RateLimiter.hpp"
+#include "../include/SaturationBlock.hpp"
+#include "../include/SineWaveGenerator.hpp"
+#include "../include/WhiteNoiseGenerator.hpp"
+#include "../include/Simulation/MonteCarloRunner.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Небольшой контур управления со всеми видами состояния блоков
+ */
+struct Loop
+{
+    PID<double> pid{1.2, 0.4, 0.05};
+    IntegratorBlock<double> plant{-5.0, 5.0};
+    RateLimiter<double> actuator{2.0, -2.0};
+    SaturationBlock<double> saturation{-1.0, 1.0};
+    DerivativeBlock<double> rate;
+    LookupTable1D<double, 4> gain{{0.0, 1.0, 3.0, 4.0}, {1.0, 0.8, 0.5, 0.4}};
+    WhiteNoiseGenerator<double, std::mutex, Philox4x32> noise{0.0, 0.01, Philox4x32(7)};
+
+    Loop()
+    {
+        gain.enableSegmentHint(true);
+    }
+
+    double step(double reference, double dt)
+    {
+        noise.step();
+        const double measured = plant.getOutput() + noise.getOutput();
+        gain.interpolate(std::fabs(measured));
+        pid.step((reference - measured) * gain.getOutput(), dt);
+        saturation.step(pid.getOutput());
+        actuator.step(saturation.getOutput(), dt);
+        plant.step(actuator.getOutput() - 0.2 * plant.getOutput(), dt);
+        rate.step(plant.getOutput(), dt);
+        return plant.getOutput() + rate.getOutput();
+    }
+
+    std::vector<std::uint8_t> save()
+    {
+        return saveCheckpoint(pid, plant, actuator, saturation, rate, gain, noise);
+    }
+
+    void restore(const std::vector<std::uint8_t>& checkpoint)
+    {
+        restoreCheckpoint(checkpoint, pid, plant, actuator, saturation, rate, gain, noise);
+    }
+};
+}
+
+// Продолжение после восстановления совпадает с продолжением без остановки
+TEST(CheckpointTest, BlocksRoundTrip)
+{
+    Loop loop;
+    for (int k = 0; k < 300; k++)
+    {
+        loop.step(1.0, 0.01);
+    }
+    const auto checkpoint = loop.save();
+
+    std::vector<double> expected;
+    for (int k = 0; k < 200; k++)
+    {
+        expected.push_back(loop.step(k < 100 ? 2.0 : -1.0, 0.01));
+    }
+
+    Loop restored;
+    restored.restore(checkpoint);
+    for (int k = 0; k < 200; k++)
+    {
+        EXPECT_EQ(restored.step(k < 100 ? 2.0 : -1.0, 0.01), expected[k]);
+    }
+}
+
+// Выходы многомерных и отображённых в память таблиц сохраняются так же, как у LookupTable1D
+TEST(CheckpointTest, LookupTables)
+{
+    const std::string path = ::testing::TempDir() + "checkpoint_lookup_table_test.lut";
+    writeLookupTableFile(path, std::vector<double>{0.0, 1.0, 3.0}, std::vector<double>{2.0, 4.0, -2.0});
+
+    Prelookup<double, 3> prelookup{{0.0, 1.0, 3.0}};
+    LookupTableND<double, 3, 2> table{{0.0, 1.0, 3.0}, {0.0, 1.0}, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0}};
+    MappedLookupTable1D<double> mapped{path};
+    prelookup.step(2.5);
+    table.interpolate({2.5, 0.5});
+    mapped.interpolate(2.5);
+    const auto checkpoint = saveCheckpoint(prelookup, table, mapped);
+
+    Prelookup<double, 3> restoredPrelookup{{0.0, 1.0, 3.0}};
+    LookupTableND<double, 3, 2> restoredTable{{0.0, 1.0, 3.0}, {0.0, 1.0}, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0}};
+    MappedLookupTable1D<double> restoredMapped{path};
+    restoreCheckpoint(checkpoint, restoredPrelookup, restoredTable, restoredMapped);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(restoredPrelookup.getOutput().index, 1u);
+    EXPECT_DOUBLE_EQ(restoredPrelookup.getOutput().fraction, 0.75);
+    EXPECT_DOUBLE_EQ(restoredTable.getOutput(), table.getOutput());
+    EXPECT_DOUBLE_EQ(restoredMapped.getOutput(), -0.5);
+}
+
+// Генераторы продолжают последовательность с сохранённого места
+TEST(CheckpointTest, RandomEngines)
+{
+    RandomNumberGenerator<double, std::mutex, std::mt19937> uniform(std::mt19937(3));
+    WhiteNoiseGenerator<double, std::mutex, std::mt19937> normal(0.0, 1.0, std::mt19937(4));
+    BandLimitedWhiteNoise<double, std::mutex, Philox4x32> bandLimited(0.1, 0.05, Philox4x32(5), 16);
+    SineWaveGenerator<double, double> sine(1.0, 0.7, 0.3);
+    sine.setFixedStep(0.01);
+    Philox4x32 engine(11, 2);
+    engine.discard(5);
+
+    for (int k = 0; k < 37; k++)
+    {
+        uniform.step();
+        normal.step();
+        bandLimited.step(0.01 * k);
+        sine.step();
+    }
+    const auto checkpoint = saveCheckpoint(uniform, normal, bandLimited, sine, engine);
+
+    std::vector<double> expected;
+    for (int k = 37; k < 137; k++)
+    {
+        uniform.step();
+        normal.step();
+        bandLimited.step(0.01 * k);
+        sine.step();
+        expected.insert(expected.end(), {uniform.getOutput(), normal.getOutput(),
+                                         bandLimited.getOutput(), sine.getOutput(),
+                                         static_cast<double>(engine())});
+    }
+
+    restoreCheckpoint(checkpoint, uniform, normal, bandLimited, sine, engine);
+    std::size_t i = 0;
+    for (int k = 37; k < 137; k++)
+    {
+        uniform.step();
+        normal.step();
+        bandLimited.step(0.01 * k);
+        sine.step();
+        EXPECT_EQ(uniform.getOutput(), expected[i++]);
+        EXPECT_EQ(normal.getOutput(), expected[i++]);
+        EXPECT_EQ(bandLimited.getOutput(), expected[i++]);
+        EXPECT_EQ(sine.getOutput(), expected[i++]);
+        EXPECT_EQ(static_cast<double>(engine()), expected[i++]);
+    }
+}
+
+// Регуляторы восстанавливаются в новые экземпляры с той же настройкой
+TEST(CheckpointTest, FlightControllers)
+{
+    auto configure = [](LongitudalControl<double>& longitudal, LateralControl<double>& lateral)
+    {
+        longitudal.setVelocityPidCoeffs(0.5, 0.1, 0.0);
+        longitudal.setAltitudePidCoeffs(0.02, 0.002, 0.01);
+        longitudal.setPitchAnglePidCoeffs(1.5, 0.2, 0.1);
+        longitudal.setAngularVelocityPidCoeffs(0.8, 0.05, 0.0);
+        longitudal.setSaturationLimits(-0.3, 0.3);
+        lateral.setRudderControllCoeffs(0.3, 0.1);
+        lateral.setAileronControllCoeffs(0.4, 1.2, 0.05, 1.5, 0.2);
+        lateral.setRollSaturationLimits(-0.5, 0.5);
+        lateral.setRudderSaturationLimits(-0.4, 0.4);
+        lateral.setAileronsSaturationLimits(-0.4, 0.4);
+    };
+
+    LongitudalControl<double> longitudal;
+    LateralControl<double> lateral;
+    configure(longitudal, lateral);
+
+    auto stepBoth = [](LongitudalControl<double>& lon, LateralControl<double>& lat, int k)
+    {
+        const double t = 0.02 * k;
+        lon.step(1000.0, 60.0, 990.0 + std::sin(t), 58.0, 0.05 * std::cos(t), 0.01, 0.02);
+        lat.step(0.3, 0.1 * std::sin(t), 0.01, 0.05 * std::cos(0.5 * t), 0.0, 0.02);
+        return std::array<double, 4>{lon.getOutput().first, lon.getOutput().second,
+                                     lat.getOutput().first, lat.getOutput().second};
+    };
+
+    for (int k = 0; k < 500; k++)
+    {
+        stepBoth(longitudal, lateral, k);
+    }
+    longitudal.enableSpeedControl(false);
+    const auto checkpoint = saveCheckpoint(longitudal, lateral);
+
+    LongitudalControl<double> restoredLongitudal;
+    LateralControl<double> restoredLateral;
+    configure(restoredLongitudal, restoredLateral);
+    restoreCheckpoint(checkpoint, restoredLongitudal, restoredLateral);
+
+    for (int k = 500; k < 700; k++)
+    {
+        EXPECT_EQ(stepBoth(restoredLongitudal, restoredLateral, k), stepBoth(longitudal, lateral, k));
+    }
+}
+
+// Повреждённые, усечённые и несовместимые контрольные точки отвергаются
+TEST(CheckpointTest, InvalidCheckpoints)
+{
+    PIDBank<double> bank(8, 1.0, 0.5, 0.1);
+    bank.step(std::vector<double>(8, 1.0), 0.01);
+    auto checkpoint = saveCheckpoint(bank);
+
+    PIDBank<double> smallerBank(4);
+    EXPECT_THROW(restoreCheckpoint(checkpoint, smallerBank), std::invalid_argument);
+
+    IntegratorBlock<double> integrator;
+    EXPECT_THROW(restoreCheckpoint(checkpoint, bank, integrator), std::invalid_argument);
+
+    const auto extended = saveCheckpoint(bank, integrator);
+    EXPECT_THROW(restoreCheckpoint(extended, bank), std::invalid_argument);
+
+    auto corrupted = checkpoint;
+    corrupted.back() ^= 1;
+    EXPECT_THROW(restoreCheckpoint(corrupted, bank), std::invalid_argument);
+
+    auto truncated = checkpoint;
+    truncated.pop_back();
+    EXPECT_THROW(restoreCheckpoint(truncated, bank), std::invalid_argument);
+
+    auto foreign = checkpoint;
+    foreign[0] = 'X';
+    EXPECT_THROW(restoreCheckpoint(foreign, bank), std::invalid_argument);
+
+    EXPECT_NO_THROW(restoreCheckpoint(checkpoint, bank));
+}
+
+// Серия прогонов от общей контрольной точки совпадает с прогонами от t = 0
+TEST(CheckpointTest, MonteCarloFork)
+{
+    constexpr int warmUp = 2000;
+    constexpr int tail   = 200;
+    auto warm = [](Loop& loop)
+    {
+        for (int k = 0; k < warmUp; k++)
+        {
+            loop.step(1.0, 0.01);
+        }
+    };
+    auto finish = [](Loop& loop, MonteCarloRun& run)
+    {
+        std::normal_distribution<double> gust(0.0, 0.5);
+        double last = 0.0;
+        for (int k = 0; k < tail; k++)
+        {
+            last = loop.step(1.0 + gust(run.engine()), 0.01);
+        }
+        return std::array<double, 1>{last};
+    };
+
+    Loop prototype;
+    warm(prototype);
+    const auto checkpoint = prototype.save();
+
+    std::vector<double> forked(16);
+    std::vector<double> full(16);
+    MonteCarloRunner runner(Dispersion{}, {"output"}, 42, 2);
+    runner.run(16, [&](MonteCarloRun& run)
+    {
+        Loop loop;
+        loop.restore(checkpoint);
+        forked[run.index()] = finish(loop, run)[0];
+        return std::array<double, 1>{forked[run.index()]};
+    });
+    runner.run(16, [&](MonteCarloRun& run)
+    {
+        Loop loop;
+        warm(loop);
+        full[run.index()] = finish(loop, run)[0];
+        return std::array<double, 1>{full[run.index()]};
+    });
+
+    EXPECT_EQ(forked, full);
+    EXPECT_NE(forked[0], forked[1]);
+}
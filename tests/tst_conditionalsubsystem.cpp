@@ -0,0 +1,180 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "../include/Checkpoint.hpp"
+#include "../include/ConditionalSubsystem.hpp"
+#include "../include/FixedPoint.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/Simulation/Model.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Включаемая подсистема выполняет блоки только при положительном сигнале
+// и по умолчанию удерживает выход и состояния
+TEST(ConditionalSubsystem, EnabledHeld)
+{
+    IntegratorBlock<double, NullMutex> integrator;
+    int calls = 0;
+    ConditionalSubsystem<double> subsystem(Activation::Enabled, [&](const double& input, const double& dt)
+    {
+        ++calls;
+        integrator.step(input, dt);
+        return integrator.getOutput();
+    });
+
+    subsystem.step(1.0, 1.0, 0.5);
+    subsystem.step(1.0, 1.0, 0.5);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), 1.0);
+    EXPECT_TRUE(subsystem.isActive());
+
+    subsystem.step(1.0, 0.0, 0.5);
+    subsystem.step(1.0, -1.0, 0.5);
+    EXPECT_FALSE(subsystem.isActive());
+    EXPECT_EQ(calls, 2);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), 1.0);
+
+    // Интегратор продолжает с сохранённого состояния, пауза не интегрируется
+    subsystem.step(1.0, 1.0, 0.5);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), 1.5);
+    EXPECT_EQ(subsystem.getExecutionCount(), 3u);
+}
+
+// Сброс выхода при выключении и состояний при включении
+TEST(ConditionalSubsystem, EnabledReset)
+{
+    IntegratorBlock<double, NullMutex> integrator;
+    ConditionalSubsystem<double, bool> subsystem(Activation::Enabled, [&](const double& input, const double& dt)
+    {
+        integrator.step(input, dt);
+        return integrator.getOutput();
+    }, -1.0);
+    subsystem.setInactiveOutput(InactiveOutput::Reset);
+    subsystem.setEnableStates(EnableStates::Reset);
+    subsystem.addStates(integrator);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), -1.0);
+
+    subsystem.step(2.0, true, 0.5);
+    subsystem.step(2.0, true, 0.5);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), 2.0);
+
+    subsystem.step(2.0, false, 0.5);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), -1.0);
+    EXPECT_DOUBLE_EQ(integrator.getOutput(), 2.0);
+
+    subsystem.step(2.0, true, 0.5);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), 1.0);
+
+    subsystem.reset();
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), -1.0);
+    EXPECT_DOUBLE_EQ(integrator.getOutput(), 0.0);
+    EXPECT_EQ(subsystem.getExecutionCount(), 0u);
+}
+
+// Срабатывание по фронтам и время, прошедшее с предыдущего выполнения
+TEST(ConditionalSubsystem, TriggerEdges)
+{
+    const std::vector<double> control = {0, 1, 1, 0, -1, 1, 0, 0};
+
+    auto run = [&](Activation activation)
+    {
+        std::vector<double> intervals;
+        ConditionalSubsystem<double> subsystem(activation, [&](const double& input, const double& dt)
+        {
+            intervals.push_back(dt);
+            return input;
+        });
+        for (std::size_t k = 0; k < control.size(); k++)
+        {
+            subsystem.step(static_cast<double>(k), control[k], 0.25);
+        }
+        return std::make_pair(intervals, subsystem.getOutput());
+    };
+
+    const auto rising = run(Activation::Rising);
+    EXPECT_THAT(rising.first, ElementsAre(0.5, 1.0));
+    EXPECT_DOUBLE_EQ(rising.second, 5.0);
+
+    const auto falling = run(Activation::Falling);
+    EXPECT_THAT(falling.first, ElementsAre(1.0, 0.75));
+    EXPECT_DOUBLE_EQ(falling.second, 6.0);
+
+    const auto either = run(Activation::Either);
+    EXPECT_THAT(either.first, ElementsAre(0.5, 0.5, 0.5, 0.25));
+    EXPECT_DOUBLE_EQ(either.second, 6.0);
+
+    EXPECT_THROW(ConditionalSubsystem<double>(Activation::Rising, nullptr), std::invalid_argument);
+}
+
+// Функция подсистемы может читать её выход: мьютекс на время вызова не захвачен
+TEST(ConditionalSubsystem, BodyReadsOwnOutput)
+{
+    std::unique_ptr<ConditionalSubsystem<double>> subsystem;
+    subsystem = std::make_unique<ConditionalSubsystem<double>>(Activation::Enabled,
+                                                               [&](const double& input, const double&)
+    {
+        EXPECT_TRUE(subsystem->isActive());
+        return subsystem->getOutput() + input;
+    });
+    subsystem->step(1.0, 1.0, 0.1);
+    subsystem->step(2.0, 1.0, 0.1);
+    EXPECT_DOUBLE_EQ(subsystem->getOutput(), 3.0);
+}
+
+// Шаг времени передаётся в типе сигнала, в том числе с фиксированной точкой
+TEST(ConditionalSubsystem, FixedPointTime)
+{
+    using Q16 = Fixed<16, 16>;
+    std::vector<Q16> intervals;
+    ConditionalSubsystem<Q16, Q16, NullMutex> subsystem(Activation::Rising, [&](const Q16& input, const Q16& dt)
+    {
+        intervals.push_back(dt);
+        return input;
+    });
+    subsystem.step(Q16(1.0), Q16(0.0), Q16(0.25));
+    subsystem.step(Q16(2.0), Q16(1.0), Q16(0.25));
+    EXPECT_THAT(intervals, ElementsAre(Q16(0.5)));
+    EXPECT_EQ(subsystem.getOutput(), Q16(2.0));
+}
+
+// Подсистема как блок модели и контрольная точка
+TEST(ConditionalSubsystem, ModelAndCheckpoint)
+{
+    ConditionalSubsystem<double, double, NullMutex> subsystem(Activation::Rising, [](const double& input, const double&)
+    {
+        return 2 * input;
+    });
+
+    Model<double> model(0.1);
+    auto input = model.addInport("Input");
+    auto trigger = model.addInport("Trigger");
+    auto block = model.add(subsystem, "Subsystem");
+    model.connect(input.out(), block.in(0));
+    model.connect(trigger.out(), block.in(1));
+    model.compile();
+
+    model.setInput(input, 3.0);
+    model.setInput(trigger, 1.0);
+    model.step();
+    EXPECT_DOUBLE_EQ(model.signal(block.out()), 6.0);
+    model.setInput(input, 4.0);
+    model.step();
+    EXPECT_DOUBLE_EQ(model.signal(block.out()), 6.0);
+
+    const auto checkpoint = saveCheckpoint(subsystem);
+    model.setInput(trigger, 0.0);
+    model.step();
+    model.setInput(trigger, 1.0);
+    model.step();
+    EXPECT_DOUBLE_EQ(model.signal(block.out()), 8.0);
+
+    // После восстановления сигнал уже был положительным, фронта нет
+    restoreCheckpoint(checkpoint, subsystem);
+    subsystem.step(5.0, 1.0, 0.1);
+    EXPECT_DOUBLE_EQ(subsystem.getOutput(), 6.0);
+    EXPECT_EQ(subsystem.getExecutionCount(), 1u);
+}
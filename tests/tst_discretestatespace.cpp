@@ -0,0 +1,134 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../include/DiscreteStateSpace.hpp"
+#include "../include/ThreadingPolicy.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Допуск сравнения банка с отдельными блоками
+ *
+ * При сборке с FMA развёрнутый и векторный циклы округляют по-разному,
+ * поэтому результаты совпадают с точностью до нескольких младших разрядов.
+ */
+double tolerance(double expected)
+{
+    return 1e-12 * std::fabs(expected) + 1e-15;
+}
+}
+
+// Класс теста для блоков DiscreteStateSpace и DiscreteStateSpaceBank
+class DiscreteStateSpaceTest : public ::testing::Test
+{
+protected:
+    static constexpr double dt = 0.1;
+
+    // Двойной интегратор: положение и скорость, вход - ускорение
+    const Matrix<double, 2, 2> a{{{1.0, dt}, {0.0, 1.0}}};
+    const Matrix<double, 2, 1> b{{{0.5 * dt * dt}, {dt}}};
+    const Matrix<double, 2, 2> c{{{1.0, 0.0}, {0.0, 1.0}}};
+
+    DiscreteStateSpace<double, 2, 1, 2> system{a, b, c};
+};
+
+// Выход вычисляется по состоянию до шага, состояние обновляется после
+TEST_F(DiscreteStateSpaceTest, DoubleIntegrator)
+{
+    double position = 0.0;
+    double velocity = 0.0;
+    for (int k = 0; k < 50; k++)
+    {
+        system.step({2.0});
+        EXPECT_DOUBLE_EQ(system.getOutput()[0], position);
+        EXPECT_DOUBLE_EQ(system.getOutput()[1], velocity);
+
+        position = position + dt * velocity + 0.5 * dt * dt * 2.0;
+        velocity = velocity + dt * 2.0;
+    }
+    EXPECT_NEAR(system.getState()[0], 0.5 * 2.0 * 5.0 * 5.0, 1e-9);
+    EXPECT_NEAR(system.getState()[1], 2.0 * 5.0, 1e-9);
+}
+
+// Матрица D передаёт вход на выход на том же шаге
+TEST_F(DiscreteStateSpaceTest, Feedthrough)
+{
+    DiscreteStateSpace<double, 1, 2, 1> mixer{{{{0.5}}}, {{{1.0, 0.0}}}, {{{1.0}}}, {{{0.0, 3.0}}}};
+    mixer.step({1.0, 2.0});
+    EXPECT_DOUBLE_EQ(mixer.getOutput()[0], 6.0);
+    mixer.step({0.0, 0.0});
+    EXPECT_DOUBLE_EQ(mixer.getOutput()[0], 1.0);
+    mixer.step({0.0, 0.0});
+    EXPECT_DOUBLE_EQ(mixer.getOutput()[0], 0.5);
+}
+
+// Установка состояния и сброс
+TEST_F(DiscreteStateSpaceTest, SetStateAndReset)
+{
+    system.setState({1.0, -1.0});
+    system.step({0.0});
+    EXPECT_DOUBLE_EQ(system.getOutput()[0], 1.0);
+    EXPECT_DOUBLE_EQ(system.getState()[0], 1.0 - dt);
+
+    system.reset();
+    EXPECT_DOUBLE_EQ(system.getOutput()[0], 0.0);
+    EXPECT_DOUBLE_EQ(system.getState()[0], 0.0);
+    EXPECT_DOUBLE_EQ(system.getState()[1], 0.0);
+}
+
+// Каждый канал банка совпадает с отдельным блоком
+TEST_F(DiscreteStateSpaceTest, BankMatchesSingleSystems)
+{
+    constexpr std::size_t lanes = 13;
+    DiscreteStateSpaceBank<double, 2, 1, 2, NullMutex> bank{lanes, a, b, c};
+    std::vector<DiscreteStateSpace<double, 2, 1, 2, NullMutex>> systems(lanes, {a, b, c});
+    ASSERT_EQ(bank.size(), lanes);
+
+    for (std::size_t lane = 0; lane < lanes; lane++)
+    {
+        bank.setState(lane, {0.1 * static_cast<double>(lane), -0.2});
+        systems[lane].setState({0.1 * static_cast<double>(lane), -0.2});
+    }
+
+    std::vector<double> inputs(lanes);
+    for (int k = 0; k < 100; k++)
+    {
+        for (std::size_t lane = 0; lane < lanes; lane++)
+        {
+            inputs[lane] = std::sin(0.1 * k + static_cast<double>(lane));
+            systems[lane].step({inputs[lane]});
+        }
+        bank.step(inputs);
+
+        for (std::size_t lane = 0; lane < lanes; lane++)
+        {
+            EXPECT_NEAR(bank.getOutput(lane, 0), systems[lane].getOutput()[0], tolerance(systems[lane].getOutput()[0]));
+            EXPECT_NEAR(bank.getOutput(lane, 1), systems[lane].getOutput()[1], tolerance(systems[lane].getOutput()[1]));
+        }
+    }
+    EXPECT_NEAR(bank.getState(5)[1], systems[5].getState()[1], tolerance(systems[5].getState()[1]));
+    EXPECT_NEAR(bank.getOutputs()[lanes + 3], systems[3].getOutput()[1], tolerance(systems[3].getOutput()[1]));
+}
+
+// Ошибки размеров и номеров каналов банка
+TEST_F(DiscreteStateSpaceTest, BankErrors)
+{
+    DiscreteStateSpaceBank<double, 2, 1, 2> bank{4, a, b, c};
+    EXPECT_THROW(bank.step(std::vector<double>(3)), std::invalid_argument);
+    EXPECT_THROW(bank.getOutput(4), std::out_of_range);
+    EXPECT_THROW(bank.getOutput(0, 2), std::out_of_range);
+    EXPECT_THROW(bank.setState(4, {0.0, 0.0}), std::out_of_range);
+
+    bank.setState(1, {1.0, 1.0});
+    bank.step(std::vector<double>(4, 0.0));
+    bank.reset();
+    EXPECT_DOUBLE_EQ(bank.getState(1)[0], 0.0);
+    EXPECT_DOUBLE_EQ(bank.getOutput(1), 0.0);
+}
@@ -0,0 +1,142 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../include/Chain.hpp"
+#include "../include/DiscreteStateSpace.hpp"
+#include "../include/DiscreteTransferFcn.hpp"
+#include "../include/SaturationBlock.hpp"
+#include "../include/ThreadingPolicy.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Допуск сравнения банка с отдельными блоками
+ *
+ * При сборке с FMA развёрнутый и векторный циклы округляют по-разному,
+ * поэтому результаты совпадают с точностью до нескольких младших разрядов.
+ */
+double tolerance(double expected)
+{
+    return 1e-12 * std::fabs(expected) + 1e-15;
+}
+}
+
+// Класс теста для блоков DiscreteTransferFcn и DiscreteTransferFcnBank
+class DiscreteTransferFcnTest : public ::testing::Test
+{
+protected:
+    // Фильтр нижних частот y[k] = 0.5 y[k-1] + 0.5 u[k]
+    DiscreteTransferFcn<double, 1> lowPass{{0.5, 0.0}, {1.0, -0.5}};
+    // Задержка на один такт 1 / z
+    DiscreteTransferFcn<double, 1> delay{{0.0, 1.0}, {1.0, 0.0}};
+};
+
+// Переходная характеристика фильтра первого порядка
+TEST_F(DiscreteTransferFcnTest, FirstOrderStep)
+{
+    lowPass.step(1.0);
+    EXPECT_DOUBLE_EQ(lowPass.getOutput(), 0.5);
+    lowPass.step(1.0);
+    EXPECT_DOUBLE_EQ(lowPass.getOutput(), 0.75);
+    lowPass.step(1.0);
+    EXPECT_DOUBLE_EQ(lowPass.getOutput(), 0.875);
+
+    lowPass.reset();
+    EXPECT_DOUBLE_EQ(lowPass.getOutput(), 0.0);
+    lowPass.step(1.0);
+    EXPECT_DOUBLE_EQ(lowPass.getOutput(), 0.5);
+}
+
+// Блок без прямой связи выдаёт вход прошлого шага
+TEST_F(DiscreteTransferFcnTest, UnitDelay)
+{
+    delay.step(3.0);
+    EXPECT_DOUBLE_EQ(delay.getOutput(), 0.0);
+    delay.step(-2.0);
+    EXPECT_DOUBLE_EQ(delay.getOutput(), 3.0);
+    delay.step(0.0);
+    EXPECT_DOUBLE_EQ(delay.getOutput(), -2.0);
+}
+
+// Коэффициенты нормируются по a0, нулевой a0 недопустим
+TEST_F(DiscreteTransferFcnTest, Normalization)
+{
+    DiscreteTransferFcn<double, 1> scaled{{1.0, 0.0}, {2.0, -1.0}};
+    for (int k = 0; k < 10; k++)
+    {
+        scaled.step(1.0);
+        lowPass.step(1.0);
+        EXPECT_DOUBLE_EQ(scaled.getOutput(), lowPass.getOutput());
+    }
+
+    using Filter = DiscreteTransferFcn<double, 1>;
+    EXPECT_THROW(Filter({1.0, 0.0}, {0.0, 1.0}), std::invalid_argument);
+    EXPECT_THROW(lowPass.setCoefficients({1.0, 0.0}, {0.0, 1.0}), std::invalid_argument);
+}
+
+// Второй порядок совпадает с эквивалентной моделью в пространстве состояний
+TEST_F(DiscreteTransferFcnTest, MatchesStateSpace)
+{
+    // H(z) = (0.2 z^2 + 0.1 z + 0.05) / (z^2 - 1.2 z + 0.5)
+    DiscreteTransferFcn<double, 2> filter{{0.2, 0.1, 0.05}, {1.0, -1.2, 0.5}};
+
+    // Каноническая форма наблюдаемости: b_i - a_i * b0
+    DiscreteStateSpace<double, 2, 1, 1> equivalent{{{{1.2, 1.0}, {-0.5, 0.0}}},
+                                                   {{{0.1 + 1.2 * 0.2}, {0.05 - 0.5 * 0.2}}},
+                                                   {{{1.0, 0.0}}},
+                                                   {{{0.2}}}};
+    for (int k = 0; k < 200; k++)
+    {
+        const double input = std::sin(0.05 * k) + (k % 17 == 0 ? 1.0 : 0.0);
+        filter.step(input);
+        equivalent.step({input});
+        EXPECT_NEAR(filter.getOutput(), equivalent.getOutput()[0], 1e-12);
+    }
+}
+
+// Каждый канал банка совпадает с отдельным блоком
+TEST_F(DiscreteTransferFcnTest, BankMatchesSingleFilters)
+{
+    constexpr std::size_t lanes = 11;
+    const DiscreteTransferFcn<double, 3>::Coefficients num{0.01, 0.03, 0.03, 0.01};
+    const DiscreteTransferFcn<double, 3>::Coefficients den{1.0, -2.0, 1.4, -0.32};
+
+    DiscreteTransferFcnBank<double, 3, NullMutex> bank{lanes, num, den};
+    std::vector<DiscreteTransferFcn<double, 3, NullMutex>> filters(lanes, {num, den});
+
+    std::vector<double> inputs(lanes);
+    for (int k = 0; k < 100; k++)
+    {
+        for (std::size_t lane = 0; lane < lanes; lane++)
+        {
+            inputs[lane] = std::cos(0.2 * k * static_cast<double>(lane + 1));
+            filters[lane].step(inputs[lane]);
+        }
+        bank.step(inputs);
+
+        for (std::size_t lane = 0; lane < lanes; lane++)
+        {
+            EXPECT_NEAR(bank.getOutput(lane), filters[lane].getOutput(), tolerance(filters[lane].getOutput()));
+        }
+    }
+
+    EXPECT_THROW(bank.step(std::vector<double>(lanes + 1)), std::invalid_argument);
+    bank.reset();
+    EXPECT_DOUBLE_EQ(bank.getOutputs()[0], 0.0);
+}
+
+// Блок встраивается в цепочку через process()
+TEST_F(DiscreteTransferFcnTest, Chain)
+{
+    SaturationBlock<double> saturation{-0.6, 0.6};
+    auto blocks = chain(lowPass, saturation);
+    EXPECT_DOUBLE_EQ(blocks.step(1.0, 0.01), 0.5);
+    EXPECT_DOUBLE_EQ(blocks.step(1.0, 0.01), 0.6);
+}
@@ -0,0 +1,189 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include "../include/DerivativeBlock.hpp"
+#include "../include/FixedPoint.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/LookupTable1D.hpp"
+#include "../include/PID.hpp"
+#include "../include/RateLimiter.hpp"
+#include "../include/SaturationBlock.hpp"
+#include "../include/ThreadingPolicy.hpp"
+#include "../include/Simulation/Model.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+using Q16 = Fixed<16, 16>;
+using Q8  = Fixed<8, 8>;
+
+
+// Преобразования округляют к ближайшему и насыщаются
+TEST(FixedPointTest, Conversion)
+{
+    static_assert(std::is_same_v<Q16::Raw, std::int32_t>);
+    static_assert(std::is_same_v<Q8::Raw, std::int16_t>);
+    static_assert(static_cast<double>(Q16(1.5)) == 1.5);
+
+    EXPECT_EQ(Q16(1.0).raw(), 65536);
+    EXPECT_EQ(Q16(-0.5).raw(), -32768);
+    EXPECT_EQ(Q8(0.3).raw(), 77);
+    EXPECT_EQ(Q8(-0.3).raw(), -77);
+    EXPECT_EQ(static_cast<int>(Q8(2.75)), 2);
+    EXPECT_EQ(static_cast<int>(Q8(-2.75)), -2);
+
+    EXPECT_EQ(Q8(1000.0), std::numeric_limits<Q8>::max());
+    EXPECT_EQ(Q8(-1000), std::numeric_limits<Q8>::lowest());
+    EXPECT_EQ(Q8(1000u), std::numeric_limits<Q8>::max());
+    EXPECT_EQ(Q8(std::nan("")).raw(), 0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(std::numeric_limits<Q8>::max()), 128.0 - 1.0 / 256);
+    EXPECT_DOUBLE_EQ(static_cast<double>(std::numeric_limits<Q8>::epsilon()), 1.0 / 256);
+}
+
+// Арифметика насыщается на границах диапазона вместо переполнения
+TEST(FixedPointTest, SaturatingArithmetic)
+{
+    const Q8 big(100.0);
+    EXPECT_EQ(big + big, std::numeric_limits<Q8>::max());
+    EXPECT_EQ(-big - big, std::numeric_limits<Q8>::lowest());
+    EXPECT_EQ(big * Q8(-2.0), std::numeric_limits<Q8>::lowest());
+    EXPECT_EQ(-std::numeric_limits<Q8>::lowest(), std::numeric_limits<Q8>::max());
+
+    EXPECT_EQ(Q8(1.0) / Q8(0.0), std::numeric_limits<Q8>::max());
+    EXPECT_EQ(Q8(-1.0) / Q8(0.0), std::numeric_limits<Q8>::lowest());
+    EXPECT_EQ(Q8(0.0) / Q8(0.0), Q8(0.0));
+}
+
+// Точность умножения и деления - половина и один шаг представления
+TEST(FixedPointTest, Precision)
+{
+    const double lsb = 1.0 / 65536;
+    for (double a = -50.0; a < 50.0; a += 3.37)
+    {
+        for (double b = -7.0; b < 7.0; b += 0.731)
+        {
+            const Q16 fa(a);
+            const Q16 fb(b);
+            const double exactProduct = static_cast<double>(fa) * static_cast<double>(fb);
+            EXPECT_NEAR(static_cast<double>(fa * fb), exactProduct, 0.5 * lsb);
+            EXPECT_NEAR(static_cast<double>(fa / fb), static_cast<double>(fa) / static_cast<double>(fb), lsb);
+            EXPECT_EQ(static_cast<double>(fa + fb), static_cast<double>(fa) + static_cast<double>(fb));
+        }
+    }
+}
+
+// Интегрирование с насыщением на пределах и установка состояния
+TEST(FixedPointTest, Integrator)
+{
+    IntegratorBlock<Q16, NullMutex> integrator(Q16(-1.0), Q16(1.0));
+    const Q16 dt(0.01);
+    for (int k = 0; k < 50; k++)
+    {
+        integrator.step(Q16(1.0), dt);
+    }
+    EXPECT_NEAR(static_cast<double>(integrator.getOutput()), 0.5, 50.0 / 65536);
+    for (int k = 0; k < 100; k++)
+    {
+        integrator.step(Q16(1.0), dt);
+    }
+    EXPECT_EQ(integrator.getOutput(), Q16(1.0));
+}
+
+// Пределы блока насыщения по умолчанию - весь диапазон типа
+TEST(FixedPointTest, Saturation)
+{
+    SaturationBlock<Q8> unlimited;
+    unlimited.step(Q8(-100.0));
+    EXPECT_EQ(unlimited.getOutput(), Q8(-100.0));
+
+    SaturationBlock<double> unlimitedDouble;
+    unlimitedDouble.step(-100.0);
+    EXPECT_DOUBLE_EQ(unlimitedDouble.getOutput(), -100.0);
+
+    SaturationBlock<Q8> limited(Q8(-1.0), Q8(2.0));
+    limited.step(Q8(5.0));
+    EXPECT_EQ(limited.getOutput(), Q8(2.0));
+}
+
+// Ограничение скорости изменения
+TEST(FixedPointTest, RateLimiter)
+{
+    RateLimiter<Q16, NullMutex> limiter(Q16(1.0), Q16(-2.0));
+    const Q16 dt(0.125);
+    limiter.step(Q16(10.0), dt);
+    EXPECT_EQ(limiter.getOutput(), Q16(0.125));
+    limiter.step(Q16(-10.0), dt);
+    EXPECT_EQ(limiter.getOutput(), Q16(-0.125));
+    limiter.step(Q16(-0.2), dt);
+    EXPECT_EQ(limiter.getOutput(), Q16(-0.2));
+}
+
+// ПИД регулятор совпадает с double с точностью до ошибок округления
+TEST(FixedPointTest, PidMatchesDouble)
+{
+    PID<double, NullMutex> reference(2.0, 0.5, 0.05);
+    PID<Q16, NullMutex> fixed(Q16(2.0), Q16(0.5), Q16(0.05));
+
+    const double dt = 0.01;
+    double maxError = 0.0;
+    for (int k = 0; k < 1000; k++)
+    {
+        const double input = std::sin(0.01 * k);
+        reference.step(input, dt);
+        fixed.step(Q16(input), Q16(dt));
+        maxError = std::max(maxError, std::fabs(static_cast<double>(fixed.getOutput()) - reference.getOutput()));
+    }
+    EXPECT_LT(maxError, 0.05);
+}
+
+// Блоки с фиксированной точкой в модели получают шаг времени в своём типе
+TEST(FixedPointTest, ModelBlocks)
+{
+    PID<double, NullMutex> reference(2.0, 0.5, 0.05);
+    PID<Q16, NullMutex> pid(Q16(2.0), Q16(0.5), Q16(0.05));
+    DerivativeBlock<Q16, NullMutex> derivative;
+
+    Model<double> model(0.01);
+    auto input = model.addInport("Input");
+    auto pidBlock = model.add(pid, "PID");
+    auto derivativeBlock = model.add(derivative, "Derivative");
+    model.connect(input.out(), pidBlock.in());
+    model.connect(input.out(), derivativeBlock.in());
+    model.compile();
+
+    for (int k = 0; k < 100; k++)
+    {
+        const double value = std::sin(0.01 * k);
+        model.setInput(input, value);
+        model.step();
+        reference.step(value, 0.01);
+        EXPECT_NEAR(model.signal(pidBlock.out()), reference.getOutput(), 0.05);
+    }
+    EXPECT_NEAR(model.signal(derivativeBlock.out()), std::cos(0.99), 0.05);
+}
+
+// Интерполяция по таблице, в том числе вычисленной на этапе компиляции
+TEST(FixedPointTest, LookupTable)
+{
+    static constexpr StaticLookupTable1D<Q16, 3> curve{{Q16(0.0), Q16(5.0), Q16(10.0)},
+                                                       {Q16(0.1), Q16(0.6), Q16(1.0)}};
+    static_assert(curve.isUniform());
+    static_assert(curve.interpolate(Q16(2.5)) > Q16(0.3));
+
+    LookupTable1D<Q16, 4, NullMutex> table({Q16(0.0), Q16(1.0), Q16(3.0), Q16(4.0)},
+                                           {Q16(0.0), Q16(2.0), Q16(-2.0), Q16(0.0)});
+    table.interpolate(Q16(2.0));
+    EXPECT_EQ(table.getOutput(), Q16(0.0));
+    table.interpolate(Q16(0.25));
+    EXPECT_EQ(table.getOutput(), Q16(0.5));
+    table.interpolate(Q16(5.0));
+    EXPECT_EQ(table.getOutput(), Q16(2.0));
+
+    LookupTable1D<Q16, 3, NullMutex> uniform(curve);
+    uniform.interpolate(Q16(7.5));
+    EXPECT_NEAR(static_cast<double>(uniform.getOutput()), 0.8, 1e-4);
+}
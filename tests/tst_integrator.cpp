@@ -86,3 +86,25 @@ TEST_F(IntegratorBlockTest, IntegratorResetState)
     integrator.reset();
     EXPECT_EQ(integrator.getOutput(), 0.0);
 }
+
+// Блок без синхронизации должен вести себя так же, как блок с мьютексом
+TEST_F(IntegratorBlockTest, NullMutexPolicyStep)
+{
+    IntegratorBlock<double, NullMutex> unsynchronized{-10.0, 10.0, 0.0};
+    integrator_bounds.setState(0.0);
+
+    for (int i = 0; i < 30; i++)
+    {
+        unsynchronized.step(1.5, 0.3);
+        integrator_bounds.step(1.5, 0.3);
+        EXPECT_EQ(unsynchronized.getOutput(), integrator_bounds.getOutput());
+    }
+}
+
+// Блок со спин-блокировкой должен вести себя так же, как блок с мьютексом
+TEST_F(IntegratorBlockTest, SpinMutexPolicyStep)
+{
+    IntegratorBlock<double, SpinMutex> spinLocked;
+    spinLocked.step(2.5, 0.1);
+    EXPECT_DOUBLE_EQ(spinLocked.getOutput(), 0.25);
+}
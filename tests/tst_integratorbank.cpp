@@ -0,0 +1,99 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../include/IntegratorBank.hpp"
+#include "../include/IntegratorBlock.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Класс теста для класса IntegratorBank
+class IntegratorBankTest : public ::testing::Test
+{
+protected:
+    IntegratorBank<double, 4> bank;
+    IntegratorBank<double, 4> bank_bounds{-10.0, 10.0};
+};
+
+// Проверка инициализации состояния
+TEST_F(IntegratorBankTest, DefaultState)
+{
+    for (std::size_t i = 0; i < bank.size(); i++)
+    {
+        EXPECT_DOUBLE_EQ(bank.getOutput(i), 0.0);
+    }
+}
+
+// Шаг интегрирования с положительным и отрицательным значением
+TEST_F(IntegratorBankTest, IntegrationStep)
+{
+    bank.step({2.5, -1.0, 0.0, 4.0}, 0.1);
+    EXPECT_DOUBLE_EQ(bank.getOutput(0), 0.25);
+    EXPECT_DOUBLE_EQ(bank.getOutput(1), -0.1);
+    EXPECT_DOUBLE_EQ(bank.getOutput(2), 0.0);
+    EXPECT_DOUBLE_EQ(bank.getOutput(3), 0.4);
+}
+
+// Интегрирование с превышением верхнего и нижнего пределов
+TEST_F(IntegratorBankTest, IntegrationLimitsStep)
+{
+    bank_bounds.step({50, -10, 1, -50}, 0.5);
+    EXPECT_EQ(bank_bounds.getOutput(0), 10);
+    EXPECT_EQ(bank_bounds.getOutput(1), -5);
+    EXPECT_EQ(bank_bounds.getOutput(2), 0.5);
+    EXPECT_EQ(bank_bounds.getOutput(3), -10);
+}
+
+// Установка новых пределов интегрирования для одного канала
+TEST_F(IntegratorBankTest, IntegrationChannelLimitsStep)
+{
+    bank_bounds.setLimits(1, -5.0, 5.0);
+    bank_bounds.step({10, 10, 10, 10}, 1.0);
+    EXPECT_EQ(bank_bounds.getOutput(0), 10);
+    EXPECT_EQ(bank_bounds.getOutput(1), 5);
+    EXPECT_THROW(bank_bounds.setLimits(1, 5.0, -5.0), std::invalid_argument);
+}
+
+// Обнуление одного канала не затрагивает остальные
+TEST_F(IntegratorBankTest, ResetChannel)
+{
+    bank.setState(0, 3.0);
+    bank.setState(1, 4.0);
+    bank.reset(0);
+    EXPECT_EQ(bank.getOutput(0), 0.0);
+    EXPECT_EQ(bank.getOutput(1), 4.0);
+    bank.reset();
+    EXPECT_EQ(bank.getOutput(1), 0.0);
+}
+
+// Каждый канал банка должен совпадать с отдельным IntegratorBlock
+TEST(DynamicIntegratorBank, MatchesIntegratorBlock)
+{
+    const std::size_t channels = 37;
+    DynamicIntegratorBank<double, NullMutex> bank(channels, -3.0, 3.0);
+    std::vector<IntegratorBlock<double, NullMutex>> blocks(channels);
+    for (auto& block : blocks)
+    {
+        block.setLimits(-3.0, 3.0);
+    }
+
+    std::vector<double> inputs(channels);
+    for (int k = 0; k < 200; k++)
+    {
+        for (std::size_t i = 0; i < channels; i++)
+        {
+            inputs[i] = std::sin(0.1 * k + static_cast<double>(i)) * (1.0 + i);
+            blocks[i].step(inputs[i], 0.05);
+        }
+        bank.step(inputs, 0.05);
+
+        for (std::size_t i = 0; i < channels; i++)
+        {
+            EXPECT_EQ(bank.getOutput(i), blocks[i].getOutput());
+        }
+    }
+    EXPECT_THROW(bank.step(std::vector<double>(3), 0.05), std::invalid_argument);
+}
@@ -1,7 +1,12 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <utility>
+#include <vector>
+
 #include "../include/LookupTable1D.hpp"
+#include "../include/LookupTableND.hpp"
 
 using namespace testing;
 using namespace SimulinkBlock;
@@ -63,3 +68,205 @@ TEST_F(LookupTable1DTest, ResetState)
     table.reset();
     EXPECT_EQ(table.getOutput(), 0.0);
 }
+
+// Равномерная таблица определяется автоматически
+TEST_F(LookupTable1DTest, UniformSpacingDetected)
+{
+    EXPECT_TRUE(table.isUniform());
+
+    LookupTable1D<double, 5> binarySearch{inputs, outputs, BreakpointSpacing::NonUniform};
+    EXPECT_FALSE(binarySearch.isUniform());
+}
+
+// Значения на границах таблицы
+TEST_F(LookupTable1DTest, TableEdges)
+{
+    table.interpolate(1.0);
+    EXPECT_DOUBLE_EQ(table.getOutput(), 10.0);
+    table.interpolate(5.0);
+    EXPECT_DOUBLE_EQ(table.getOutput(), 50.0);
+}
+
+// Неравномерная таблица использует двоичный поиск
+TEST(LookupTable1DNonUniform, Interpolation)
+{
+    LookupTable1D<double, 4> table{{0.0, 1.0, 3.0, 7.0}, {0.0, 2.0, 0.0, 8.0}};
+    EXPECT_FALSE(table.isUniform());
+
+    table.interpolate(2.0);
+    EXPECT_DOUBLE_EQ(table.getOutput(), 1.0);
+    table.interpolate(5.0);
+    EXPECT_DOUBLE_EQ(table.getOutput(), 4.0);
+    table.interpolate(9.0);
+    EXPECT_DOUBLE_EQ(table.getOutput(), 12.0);
+    table.interpolate(-1.0);
+    EXPECT_DOUBLE_EQ(table.getOutput(), -2.0);
+
+    EXPECT_THROW((LookupTable1D<double, 4>{{0.0, 1.0, 3.0, 7.0}, {0.0, 2.0, 0.0, 8.0},
+                                          BreakpointSpacing::Uniform}),
+                 std::invalid_argument);
+}
+
+// Вычисление индекса и двоичный поиск дают одинаковый результат
+TEST(LookupTable1DUniform, MatchesBinarySearch)
+{
+    std::array<double, 11> x;
+    std::array<double, 11> y;
+    for (std::size_t i = 0; i < x.size(); i++)
+    {
+        x[i] = -1.0 + 0.2 * i;
+        y[i] = std::sin(x[i]);
+    }
+
+    LookupTable1D<double, 11> uniform{x, y, BreakpointSpacing::Uniform};
+    LookupTable1D<double, 11> binarySearch{x, y, BreakpointSpacing::NonUniform};
+
+    for (double value = -1.5; value <= 1.5; value += 0.0137)
+    {
+        uniform.interpolate(value);
+        binarySearch.interpolate(value);
+        EXPECT_NEAR(uniform.getOutput(), binarySearch.getOutput(), 1e-12);
+    }
+}
+
+// Целочисленная таблица: обратная величина шага не представима, наклоны не округляются
+TEST(LookupTable1DUniform, IntegerValues)
+{
+    LookupTable1D<int, 3, NullMutex> table{{0, 4, 8}, {0, 10, 100}};
+    EXPECT_FALSE(table.isUniform());
+
+    const std::vector<std::pair<int, int>> expected = {{5, 32}, {6, 55}, {8, 100}, {2, 5}, {-4, -10}, {12, 190}};
+    for (const auto& [input, output] : expected)
+    {
+        table.interpolate(input);
+        EXPECT_EQ(table.getOutput(), output) << "input " << input;
+    }
+
+    static constexpr StaticLookupTable1D<int, 3> curve{{0, 4, 8}, {0, 10, 100}};
+    static_assert(curve.interpolate(8) == 100);
+    EXPECT_THROW((LookupTable1D<int, 3>{{0, 4, 8}, {0, 10, 100}, BreakpointSpacing::Uniform}),
+                 std::invalid_argument);
+
+    // С единичным шагом обратная величина точна и индекс вычисляется
+    LookupTable1D<int, 3, NullMutex> unitStep{{0, 1, 2}, {0, 10, 100}};
+    EXPECT_TRUE(unitStep.isUniform());
+    unitStep.interpolate(2);
+    EXPECT_EQ(unitStep.getOutput(), 100);
+
+    Prelookup<int, 3, NullMutex> prelookup{{0, 4, 8}};
+    prelookup.step(5);
+    EXPECT_EQ(prelookup.getOutput().index, 1u);
+}
+
+// Пакетная интерполяция совпадает с поэлементной, включая экстраполяцию
+TEST(LookupTable1DBatch, MatchesScalarInterpolation)
+{
+    std::array<double, 9> uniformInputs = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    std::array<double, 9> nonUniformInputs = {0, 0.5, 1.5, 2, 4, 4.5, 7, 7.25, 8};
+    std::array<double, 9> outputs = {3, -1, 4, 1, -5, 9, 2, -6, 5};
+
+    LookupTable1D<double, 9> uniform{uniformInputs, outputs};
+    LookupTable1D<double, 9> nonUniform{nonUniformInputs, outputs};
+    ASSERT_TRUE(uniform.isUniform());
+    ASSERT_FALSE(nonUniform.isUniform());
+
+    std::vector<double> inputs;
+    for (double value = -2.0; value <= 10.0; value += 0.0731)
+    {
+        inputs.push_back(value);
+    }
+    inputs.push_back(8.0);
+    inputs.push_back(0.0);
+    inputs.push_back(4.0);
+
+    for (auto* table : {&uniform, &nonUniform})
+    {
+        std::vector<double> batch(inputs.size());
+        table->interpolate(inputs.data(), batch.data(), inputs.size());
+
+        for (std::size_t i = 0; i < inputs.size(); i++)
+        {
+            table->interpolate(inputs[i]);
+            EXPECT_DOUBLE_EQ(batch[i], table->getOutput());
+        }
+    }
+}
+
+// Поиск с подсказкой дает тот же результат и считает попадания
+TEST(LookupTable1DSegmentHint, HuntingMatchesBinarySearch)
+{
+    std::array<double, 6> x = {0.0, 1.0, 1.5, 4.0, 4.5, 9.0};
+    std::array<double, 6> y = {1.0, 3.0, -2.0, 0.0, 6.0, 2.0};
+    LookupTable1D<double, 6> hunting{x, y};
+    LookupTable1D<double, 6> binarySearch{x, y};
+    hunting.enableSegmentHint(true);
+
+    for (double value = -1.0; value <= 10.0; value += 0.01)
+    {
+        hunting.interpolate(value);
+        binarySearch.interpolate(value);
+        EXPECT_DOUBLE_EQ(hunting.getOutput(), binarySearch.getOutput());
+    }
+
+    // Большой скачок входа требует двоичного поиска
+    hunting.interpolate(-5.0);
+
+    SegmentHint hint = hunting.getSegmentHint();
+    EXPECT_EQ(hint.misses, 1u);
+    EXPECT_GT(hint.hitRate(), 0.99);
+}
+
+// Подсказка, принадлежащая вызывающей стороне, не изменяет выход блока
+TEST(LookupTable1DSegmentHint, CallerOwnedHint)
+{
+    std::array<double, 4> x = {0.0, 1.0, 3.0, 7.0};
+    std::array<double, 4> y = {0.0, 2.0, 0.0, 8.0};
+    const LookupTable1D<double, 4> table{x, y};
+
+    SegmentHint first;
+    SegmentHint second;
+    EXPECT_DOUBLE_EQ(table.interpolate(2.0, first), 1.0);
+    EXPECT_DOUBLE_EQ(table.interpolate(5.0, second), 4.0);
+    EXPECT_EQ(first.segment, 1u);
+    EXPECT_EQ(second.segment, 2u);
+
+    EXPECT_DOUBLE_EQ(table.interpolate(2.5, first), 0.5);
+    EXPECT_EQ(first.hits, 2u);
+}
+
+// Таблица, вычисленная и проверенная на этапе компиляции
+namespace
+{
+constexpr std::array<double, 4> liftInputs  = {0.0, 5.0, 10.0, 15.0};
+constexpr std::array<double, 4> liftOutputs = {0.1, 0.6, 1.0, 1.2};
+constexpr std::array<double, 3> badInputs   = {0.0, 2.0, 1.0};
+
+static constexpr StaticLookupTable1D<double, 4> liftCurve{liftInputs, liftOutputs};
+
+static_assert(StaticLookupTable1D<double, 4>::isStrictlyIncreasing(liftInputs));
+static_assert(!StaticLookupTable1D<double, 3>::isStrictlyIncreasing(badInputs));
+static_assert(liftCurve.isUniform());
+static_assert(liftCurve.interpolate(2.5) > 0.349 && liftCurve.interpolate(2.5) < 0.351);
+static_assert(liftCurve.interpolate(20.0) > 1.399 && liftCurve.interpolate(20.0) < 1.401);
+}
+
+TEST(StaticLookupTable1D, MatchesLookupTable1D)
+{
+    LookupTable1D<double, 4> table{liftCurve};
+    LookupTable1D<double, 4> runtimeTable{liftInputs, liftOutputs};
+
+    for (double value = -5.0; value <= 20.0; value += 0.37)
+    {
+        table.interpolate(value);
+        runtimeTable.interpolate(value);
+        EXPECT_EQ(table.getOutput(), liftCurve.interpolate(value));
+        EXPECT_EQ(runtimeTable.getOutput(), liftCurve.interpolate(value));
+    }
+}
+
+// Неупорядоченные входные значения отклоняются при создании таблицы
+TEST(StaticLookupTable1D, RejectsNonIncreasingInputs)
+{
+    EXPECT_THROW((StaticLookupTable1D<double, 3>{badInputs, {1.0, 2.0, 3.0}}), std::invalid_argument);
+    EXPECT_THROW((LookupTable1D<double, 3>{badInputs, {1.0, 2.0, 3.0}}), std::invalid_argument);
+}
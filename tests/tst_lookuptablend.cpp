@@ -0,0 +1,139 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../include/LookupTable1D.hpp"
+#include "../include/LookupTableND.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Проверка блока Prelookup
+TEST(Prelookup, IndexAndFraction)
+{
+    Prelookup<double, 4> prelookup{{0.0, 1.0, 3.0, 7.0}};
+
+    prelookup.step(2.0);
+    EXPECT_EQ(prelookup.getOutput().index, 1u);
+    EXPECT_DOUBLE_EQ(prelookup.getOutput().fraction, 0.5);
+
+    // Экстраполяция за пределами вектора точек
+    prelookup.step(-1.0);
+    EXPECT_EQ(prelookup.getOutput().index, 0u);
+    EXPECT_DOUBLE_EQ(prelookup.getOutput().fraction, -1.0);
+
+    prelookup.step(9.0);
+    EXPECT_EQ(prelookup.getOutput().index, 2u);
+    EXPECT_DOUBLE_EQ(prelookup.getOutput().fraction, 1.5);
+
+    prelookup.reset();
+    EXPECT_EQ(prelookup.getOutput().index, 0u);
+}
+
+// Повторяющиеся и неупорядоченные точки отклоняются при создании
+TEST(Prelookup, RejectsNonIncreasingBreakpoints)
+{
+    EXPECT_THROW((Prelookup<double, 3>{{0.0, 1.0, 1.0}}), std::invalid_argument);
+    EXPECT_THROW((Prelookup<double, 3>{{0.0, 2.0, 1.0}}), std::invalid_argument);
+
+    const std::array<double, 4> values = {0.0, 1.0, 2.0, 3.0};
+    EXPECT_THROW((LookupTableND<double, 2, 2>{{0.0, 1.0}, {1.0, 1.0}, values}), std::invalid_argument);
+    EXPECT_THROW((LookupTableND<double, 2, 2>{{1.0, 0.0}, {0.0, 1.0}, values}), std::invalid_argument);
+}
+
+// Одномерная таблица совпадает с LookupTable1D
+TEST(LookupTableND, OneDimensionMatchesLookupTable1D)
+{
+    std::array<double, 5> x = {0.0, 0.5, 2.0, 2.5, 6.0};
+    std::array<double, 5> y = {1.0, -1.0, 4.0, 0.0, 2.0};
+    LookupTable1D<double, 5> table1D{x, y};
+    LookupTableND<double, 5> tableND{x, y};
+
+    for (double value = -2.0; value <= 8.0; value += 0.093)
+    {
+        table1D.interpolate(value);
+        tableND.interpolate({value});
+        EXPECT_NEAR(tableND.getOutput(), table1D.getOutput(), 1e-12);
+    }
+}
+
+// Билинейная интерполяция воспроизводит функцию a + b*x + c*y + d*x*y
+TEST(LookupTableND, BilinearInterpolation)
+{
+    auto f = [](double x, double y) { return 1.0 + 2.0 * x - 3.0 * y + 0.5 * x * y; };
+
+    std::array<double, 3> xs = {0.0, 1.0, 4.0};
+    std::array<double, 4> ys = {-1.0, 0.0, 2.0, 3.0};
+    std::array<double, 12> values;
+    for (std::size_t i = 0; i < xs.size(); i++)
+    {
+        for (std::size_t j = 0; j < ys.size(); j++)
+        {
+            values[i * ys.size() + j] = f(xs[i], ys[j]);
+        }
+    }
+
+    LookupTableND<double, 3, 4> table{xs, ys, values};
+    for (double x = -1.0; x <= 5.0; x += 0.37)
+    {
+        for (double y = -2.0; y <= 4.0; y += 0.41)
+        {
+            table.interpolate({x, y});
+            EXPECT_NEAR(table.getOutput(), f(x, y), 1e-12);
+        }
+    }
+}
+
+// Результат Prelookup используется несколькими таблицами с общим вектором точек
+TEST(LookupTableND, SharedPrelookup)
+{
+    std::array<double, 3> mach  = {0.2, 0.5, 0.8};
+    std::array<double, 2> alpha = {0.0, 10.0};
+    std::array<double, 2> beta  = {-5.0, 5.0};
+
+    std::array<double, 12> liftValues;
+    for (std::size_t i = 0; i < liftValues.size(); i++)
+    {
+        liftValues[i] = static_cast<double>(i * i);
+    }
+
+    BasicLookupTableND<double, NullMutex, 3, 2, 2> lift{mach, alpha, beta, liftValues};
+    BasicLookupTableND<double, NullMutex, 3, 2> drag{mach, alpha, {1, 2, 3, 4, 5, 6}};
+
+    Prelookup<double, 3, NullMutex> machPrelookup{mach};
+    Prelookup<double, 2, NullMutex> alphaPrelookup{alpha};
+    Prelookup<double, 2, NullMutex> betaPrelookup{beta};
+
+    machPrelookup.step(0.65);
+    alphaPrelookup.step(2.5);
+    betaPrelookup.step(0.0);
+
+    lift.interpolatePrelookup({machPrelookup.getOutput(), alphaPrelookup.getOutput(), betaPrelookup.getOutput()});
+    drag.interpolatePrelookup({machPrelookup.getOutput(), alphaPrelookup.getOutput()});
+
+    BasicLookupTableND<double, NullMutex, 3, 2, 2> liftDirect{mach, alpha, beta, liftValues};
+    liftDirect.interpolate({0.65, 2.5, 0.0});
+    EXPECT_DOUBLE_EQ(lift.getOutput(), liftDirect.getOutput());
+
+    // mach: отрезок 1, доля 0.5; alpha: отрезок 0, доля 0.25
+    EXPECT_DOUBLE_EQ(drag.getOutput(), 4.25);
+
+    // Индекс из Prelookup с другим вектором точек не выходит за пределы таблицы
+    Prelookup<double, 4, NullMutex> widePrelookup{{0.0, 1.0, 2.0, 3.0}};
+    widePrelookup.step(2.5);
+    EXPECT_THROW(drag.interpolatePrelookup({widePrelookup.getOutput(), alphaPrelookup.getOutput()}), std::out_of_range);
+    EXPECT_THROW(drag.interpolatePrelookup({machPrelookup.getOutput(), {2, 0.0}}), std::out_of_range);
+    EXPECT_DOUBLE_EQ(drag.getOutput(), 4.25);
+}
+
+// Обнуление выхода таблицы
+TEST(LookupTableND, ResetState)
+{
+    LookupTableND<double, 2, 2> table{{0.0, 1.0}, {0.0, 1.0}, {0.0, 1.0, 2.0, 3.0}};
+    table.interpolate({0.5, 0.5});
+    EXPECT_DOUBLE_EQ(table.getOutput(), 1.5);
+    table.reset();
+    EXPECT_EQ(table.getOutput(), 0.0);
+}
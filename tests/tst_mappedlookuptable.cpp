@@ -0,0 +1,109 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../include/MappedLookupTable1D.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+// Класс теста для класса MappedLookupTable1D
+class MappedLookupTable1DTest : public ::testing::Test
+{
+protected:
+    std::string path = ::testing::TempDir() + "mapped_lookup_table_test.lut";
+    std::vector<double> inputs = {1.0, 2.0, 4.0, 7.0, 8.0};
+    std::vector<double> outputs = {10.0, 20.0, 0.0, 30.0, 35.0};
+
+    void TearDown() override
+    {
+        std::remove(path.c_str());
+    }
+};
+
+// Совпадение результатов с LookupTable1D на тех же данных
+TEST_F(MappedLookupTable1DTest, MatchesLookupTable1D)
+{
+    writeLookupTableFile(path, inputs, outputs);
+    MappedLookupTable1D<double> mapped(path);
+    LookupTable1D<double, 5> table({1.0, 2.0, 4.0, 7.0, 8.0}, {10.0, 20.0, 0.0, 30.0, 35.0});
+
+    EXPECT_EQ(mapped.size(), 5u);
+    EXPECT_FALSE(mapped.isUniform());
+
+    for (double x = -1.0; x <= 10.0; x += 0.25)
+    {
+        mapped.interpolate(x);
+        table.interpolate(x);
+        EXPECT_DOUBLE_EQ(mapped.getOutput(), table.getOutput()) << "x = " << x;
+    }
+}
+
+// Равномерная таблица и пакетная интерполяция с подсказкой отрезка
+TEST_F(MappedLookupTable1DTest, UniformBatchAndHint)
+{
+    std::vector<float> uniformInputs = {0.0f, 0.5f, 1.0f, 1.5f};
+    std::vector<float> uniformOutputs = {0.0f, 1.0f, 4.0f, 9.0f};
+    writeLookupTableFile(path, uniformInputs, uniformOutputs);
+    MappedLookupTable1D<float> mapped(path);
+
+    EXPECT_TRUE(mapped.isUniform());
+
+    std::vector<float> x = {-0.5f, 0.25f, 0.75f, 1.25f, 2.0f};
+    std::vector<float> y(x.size());
+    mapped.interpolate(x.data(), y.data(), x.size());
+
+    SegmentHint hint;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_FLOAT_EQ(mapped.interpolate(x[i], hint), y[i]);
+    }
+    EXPECT_FLOAT_EQ(y[1], 0.5f);
+    EXPECT_FLOAT_EQ(y[2], 2.5f);
+    EXPECT_FLOAT_EQ(y[4], 14.0f);
+}
+
+// Сброс выхода
+TEST_F(MappedLookupTable1DTest, Reset)
+{
+    writeLookupTableFile(path, inputs, outputs);
+    MappedLookupTable1D<double> mapped(path);
+
+    mapped.interpolate(1.5);
+    EXPECT_DOUBLE_EQ(mapped.getOutput(), 15.0);
+    mapped.reset();
+    EXPECT_DOUBLE_EQ(mapped.getOutput(), 0.0);
+}
+
+// Ошибки при записи и открытии файлов
+TEST_F(MappedLookupTable1DTest, InvalidFiles)
+{
+    EXPECT_THROW(writeLookupTableFile(path, std::vector<double>{1.0, 1.0}, std::vector<double>{0.0, 1.0}),
+                 std::invalid_argument);
+    EXPECT_THROW(MappedLookupTable1D<double>{path + ".missing"}, std::runtime_error);
+
+    writeLookupTableFile(path, inputs, outputs);
+    EXPECT_THROW(MappedLookupTable1D<float>{path}, std::runtime_error);
+
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << std::string(256, 'x');
+    }
+    EXPECT_THROW(MappedLookupTable1D<double>{path}, std::runtime_error);
+
+    // Количество точек, при котором count * sizeof(double) переполняется до 40 байт
+    writeLookupTableFile(path, inputs, outputs);
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        const std::uint64_t count = (std::uint64_t(1) << 61) + 5;
+        file.seekp(offsetof(LookupTableFileHeader, count));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    EXPECT_THROW(MappedLookupTable1D<double>{path}, std::runtime_error);
+}
@@ -0,0 +1,138 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "../include/Simulation/Model.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Модель повторяет цепочку из README, соединённую вручную
+TEST(Model, MatchesHandWiredChain)
+{
+    IntegratorBlock<double, NullMutex> integrator;
+    SaturationBlock<double, NullMutex> saturation{-10, 10};
+    IntegratorBlock<double, NullMutex> referenceIntegrator;
+    SaturationBlock<double, NullMutex> referenceSaturation{-10, 10};
+
+    Model<double> model(0.2);
+    // Блоки добавлены не в порядке выполнения
+    auto sat = model.add(saturation, "Saturation");
+    auto integ = model.add(integrator, "Integrator");
+    auto input = model.addConstant(1.0);
+    model.connect(input.out(), integ.in());
+    model.connect(integ.out(), sat.in());
+    model.compile();
+
+    EXPECT_EQ(model.executionOrder(), (std::vector<std::size_t>{input.id, integ.id, sat.id}));
+
+    for (int i = 0; i < 100; i++)
+    {
+        model.step();
+        referenceIntegrator.step(1, 0.2);
+        referenceSaturation.step(referenceIntegrator.getOutput());
+        EXPECT_DOUBLE_EQ(model.signal(integ.out()), referenceIntegrator.getOutput());
+        EXPECT_DOUBLE_EQ(model.signal(sat.out()), referenceSaturation.getOutput());
+    }
+    EXPECT_DOUBLE_EQ(model.time(), 20.0);
+}
+
+// Петля без задержки - алгебраическая, с задержкой - допустима
+TEST(Model, AlgebraicLoop)
+{
+    SaturationBlock<double, NullMutex> saturation{-1, 1};
+    auto makeModel = [&](bool withDelay)
+    {
+        Model<double> model(0.1);
+        auto sum = model.addFunction("Sum", 2, 1, true, [](const BlockIO<double>& io)
+        {
+            io.output(0) = io.input(0) + io.input(1);
+        });
+        auto sat = model.add(saturation, "Saturation");
+        auto one = model.addConstant(0.25);
+        model.connect(one.out(), sum.in(0));
+        model.connect(sum.out(), sat.in());
+        if (withDelay)
+        {
+            auto delay = model.addUnitDelay(0.0);
+            model.connect(sat.out(), delay.in());
+            model.connect(delay.out(), sum.in(1));
+        }
+        else
+        {
+            model.connect(sat.out(), sum.in(1));
+        }
+        return model;
+    };
+
+    Model<double> broken = makeModel(false);
+    try
+    {
+        broken.compile();
+        FAIL() << "Algebraic loop was not detected";
+    }
+    catch (const std::invalid_argument& error)
+    {
+        EXPECT_THAT(error.what(), HasSubstr("Sum"));
+        EXPECT_THAT(error.what(), HasSubstr("Saturation"));
+    }
+
+    // Накопление 0.25 за шаг с насыщением на 1
+    Model<double> accumulator = makeModel(true);
+    accumulator.compile();
+    const std::vector<double> expected = {0.25, 0.5, 0.75, 1.0, 1.0};
+    for (double value : expected)
+    {
+        accumulator.step();
+        EXPECT_DOUBLE_EQ(accumulator.signal({1, 0}), value);
+    }
+}
+
+// Внешние входы и блоки-источники, зависящие от времени
+TEST(Model, InportsAndSources)
+{
+    SineWaveGenerator<double, double, NullMutex> sine(2.0, 1.0, 0.0);
+    PID<double, NullMutex> pid(1.5, 0.0, 0.0);
+
+    Model<double> model(0.125);
+    auto reference = model.addInport("Reference");
+    auto source = model.add(sine);
+    auto error = model.addFunction("Error", 2, 1, true, [](const BlockIO<double>& io)
+    {
+        io.output(0) = io.input(0) - io.input(1);
+    });
+    auto controller = model.add(pid);
+    model.connect(reference.out(), error.in(0));
+    model.connect(source.out(), error.in(1));
+    model.connect(error.out(), controller.in());
+    model.compile();
+
+    model.setInput(reference, 3.0);
+    model.step();
+    model.step();
+    // Второй шаг выполняется в момент 0.125: sin(pi / 4) * 2
+    EXPECT_NEAR(model.signal(source.out()), std::sqrt(2.0), 1e-12);
+    EXPECT_NEAR(model.signal(controller.out()), 1.5 * (3.0 - std::sqrt(2.0)), 1e-12);
+
+    EXPECT_THROW(model.setInput(error, 1.0), std::invalid_argument);
+}
+
+// Ошибки соединения и компиляции
+TEST(Model, InvalidConnections)
+{
+    SaturationBlock<double, NullMutex> saturation{-1, 1};
+    Model<double> model(0.1);
+    auto constant = model.addConstant(1.0);
+    auto sat = model.add(saturation);
+
+    EXPECT_THROW(model.step(), std::logic_error);
+    EXPECT_THROW(model.compile(), std::invalid_argument);
+    EXPECT_THROW(model.connect(constant.out(1), sat.in()), std::invalid_argument);
+    EXPECT_THROW(model.connect(constant.out(), sat.in(1)), std::invalid_argument);
+    EXPECT_THROW(model.connect(sat.out(), constant.in()), std::invalid_argument);
+
+    model.connect(constant.out(), sat.in());
+    EXPECT_THROW(model.connect(constant.out(), sat.in()), std::invalid_argument);
+    EXPECT_NO_THROW(model.compile());
+    EXPECT_THROW(Model<double>(0.0), std::invalid_argument);
+}
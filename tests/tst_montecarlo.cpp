@@ -0,0 +1,184 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/IntegratorBlock.hpp"
+#include "../include/PID.hpp"
+#include "../include/Simulation/MonteCarloRunner.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Статистика Уэлфорда и объединение статистик частей выборки
+TEST(MonteCarlo, RunningStatistics)
+{
+    const std::vector<double> values = {4.0, -1.5, 7.25, 3.0, 0.5, 12.0, -6.0};
+    RunningStatistics all;
+    RunningStatistics head;
+    RunningStatistics tail;
+    double sum = 0.0;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        all.add(values[i]);
+        (i < 3 ? head : tail).add(values[i]);
+        sum += values[i];
+    }
+    const double mean = sum / values.size();
+    double squares = 0.0;
+    for (double value : values)
+    {
+        squares += (value - mean) * (value - mean);
+    }
+
+    EXPECT_EQ(all.count(), values.size());
+    EXPECT_NEAR(all.mean(), mean, 1e-12);
+    EXPECT_NEAR(all.variance(), squares / (values.size() - 1), 1e-12);
+    EXPECT_DOUBLE_EQ(all.min(), -6.0);
+    EXPECT_DOUBLE_EQ(all.max(), 12.0);
+
+    head.merge(tail);
+    head.merge(RunningStatistics{});
+    EXPECT_EQ(head.count(), all.count());
+    EXPECT_NEAR(head.mean(), all.mean(), 1e-12);
+    EXPECT_NEAR(head.variance(), all.variance(), 1e-12);
+    EXPECT_DOUBLE_EQ(head.min(), all.min());
+    EXPECT_DOUBLE_EQ(head.max(), all.max());
+}
+
+// Каждый номер выполняется ровно один раз, неравномерная работа перехватывается
+TEST(MonteCarlo, ThreadPoolWorkStealing)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(visits.size(), [&](std::size_t index, std::size_t worker)
+    {
+        EXPECT_LT(worker, 4u);
+        // Диапазон первого потока в сто раз дольше остальных
+        if (index < 250)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        visits[index]++;
+    });
+    for (const auto& count : visits)
+    {
+        EXPECT_EQ(count.load(), 1);
+    }
+    EXPECT_GT(pool.stealCount(), 0u);
+
+    // Исключение тела цикла передаётся вызывающему потоку, пул остаётся работоспособным
+    EXPECT_THROW(pool.parallelFor(100, [](std::size_t index, std::size_t)
+    {
+        if (index == 42)
+        {
+            throw std::runtime_error("Run failed");
+        }
+    }), std::runtime_error);
+
+    std::atomic<std::size_t> total{0};
+    pool.parallelFor(10, [&](std::size_t index, std::size_t) { total += index; });
+    EXPECT_EQ(total.load(), 45u);
+}
+
+// Разброс коэффициента регулятора в замкнутом контуре с объектом-интегратором
+TEST(MonteCarlo, DispersedClosedLoop)
+{
+    Dispersion dispersion;
+    const std::size_t gain = dispersion.addUniform("Kp", 1.0, 3.0);
+    const std::size_t bias = dispersion.addNormal("Bias", 0.0, 0.1);
+    EXPECT_THROW(dispersion.addNormal("Kp", 0.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(dispersion.addUniform("Bad", 1.0, 0.0), std::invalid_argument);
+    EXPECT_EQ(dispersion.index("Bias"), bias);
+
+    auto scenario = [gain, bias](MonteCarloRun& run)
+    {
+        PID<double, NullMutex> pid(run.parameter(gain), 0.0, 0.0);
+        IntegratorBlock<double, NullMutex> plant;
+        std::normal_distribution<double> sensorNoise(0.0, 0.01);
+
+        double ise = 0.0;
+        for (int i = 0; i < 500; i++)
+        {
+            const double error = 1.0 - plant.getOutput() + run.parameter(bias) + sensorNoise(run.engine());
+            ise += error * error * 0.01;
+            pid.step(error, 0.01);
+            plant.step(pid.getOutput(), 0.01);
+        }
+        return std::array<double, 3>{ise, plant.getOutput(), run.parameter(gain)};
+    };
+
+    MonteCarloRunner single(dispersion, {"ISE", "Final", "Kp"}, 7, 1);
+    MonteCarloRunner parallel(dispersion, {"ISE", "Final", "Kp"}, 7, 4);
+    const MonteCarloSummary reference = single.run(400, scenario);
+    const MonteCarloSummary summary = parallel.run(400, scenario);
+
+    EXPECT_EQ(summary.runs, 400u);
+    EXPECT_EQ(summary.threads, 4u);
+    EXPECT_GT(summary.runsPerSecond(), 0.0);
+    for (const char* name : {"ISE", "Final", "Kp"})
+    {
+        EXPECT_EQ(summary.metric(name).count(), 400u);
+        EXPECT_NEAR(summary.metric(name).mean(), reference.metric(name).mean(), 1e-12);
+        EXPECT_NEAR(summary.metric(name).variance(), reference.metric(name).variance(), 1e-12);
+        EXPECT_DOUBLE_EQ(summary.metric(name).min(), reference.metric(name).min());
+        EXPECT_DOUBLE_EQ(summary.metric(name).max(), reference.metric(name).max());
+    }
+
+    // Равномерный разброс [1, 3): среднее 2, дисперсия 1/3
+    EXPECT_NEAR(summary.metric("Kp").mean(), 2.0, 0.1);
+    EXPECT_NEAR(summary.metric("Kp").variance(), 1.0 / 3.0, 0.05);
+    EXPECT_GE(summary.metric("Kp").min(), 1.0);
+    EXPECT_LT(summary.metric("Kp").max(), 3.0);
+    // Контур сходится к 1 + смещение
+    EXPECT_NEAR(summary.metric("Final").mean(), 1.0, 0.03);
+    EXPECT_THROW(summary.metric("Unknown"), std::invalid_argument);
+
+    // Продолжение серии даёт те же прогоны, что и одна длинная серия
+    const MonteCarloSummary first = single.run(150, scenario);
+    MonteCarloSummary second = single.run(250, scenario, 150);
+    second.metrics[0].merge(first.metrics[0]);
+    EXPECT_NEAR(second.metrics[0].mean(), reference.metric("ISE").mean(), 1e-12);
+}
+
+// Значения разброса вычисляются библиотекой из битов Philox4x32 и не зависят от <random>
+TEST(MonteCarlo, DispersionSampling)
+{
+    Dispersion dispersion;
+    dispersion.addUniform("Gain", 1.0, 3.0);
+    dispersion.addNormal("Bias", 0.5, 2.0);
+    dispersion.addUniform("Narrow", 1.0, std::nextafter(1.0, 2.0));
+
+    Philox4x32 engine(7, 3);
+    Philox4x32 reference(7, 3);
+    auto uniform = [&reference]
+    {
+        const double high = static_cast<double>(reference() >> 5);
+        const double low  = static_cast<double>(reference() >> 6);
+        return (high * 67108864.0 + low) / 9007199254740992.0;
+    };
+
+    for (int k = 0; k < 1000; k++)
+    {
+        double values[3];
+        dispersion.sample(engine, values);
+
+        EXPECT_EQ(values[0], 1.0 + 2.0 * uniform());
+        const double u1 = 1.0 - uniform();
+        const double u2 = uniform();
+        EXPECT_NEAR(values[1], 0.5 + 2.0 * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * M_PI * u2), 1e-9);
+        uniform();
+
+        // Интервал [min, max) из одного числа: верхняя граница не выбирается
+        EXPECT_EQ(values[2], 1.0);
+    }
+}
@@ -0,0 +1,167 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "../include/Simulation/MultiRateScheduler.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Записи выходов групп трёхчастотной модели
+ */
+struct MultiRateTrace
+{
+    std::vector<double> fast;    //!< Вход быстрой группы от средней на каждом такте
+    std::vector<double> medium;  //!< Вход средней группы от быстрой на каждом её такте
+    std::vector<double> slow;    //!< Вход медленной группы от средней на каждом её такте
+};
+
+/**
+ * @brief Модель 1 кГц / 100 Гц / 10 Гц: каждая группа выдаёт номер своего запуска
+ */
+MultiRateTrace runThreeRates(MultiRateScheduler<double>::Execution execution, int ticks)
+{
+    using Scheduler = MultiRateScheduler<double>;
+    Scheduler scheduler(0.001);
+    // Группы добавлены не в порядке выполнения
+    auto slow = scheduler.addRate(0.1, execution);
+    auto fast = scheduler.addRate(0.001);
+    auto medium = scheduler.addRate(0.01, execution);
+
+    MultiRateTrace trace;
+    auto counter = [](Model<double>& model, std::vector<double>& record)
+    {
+        auto runs = std::make_shared<double>(0.0);
+        return model.addFunction("Counter", 1, 1, true, [runs, &record](const BlockIO<double>& io)
+        {
+            record.push_back(io.input(0));
+            io.output(0) = ++*runs;
+        });
+    };
+    auto fastCounter = counter(scheduler.model(fast), trace.fast);
+    auto mediumCounter = counter(scheduler.model(medium), trace.medium);
+    auto slowCounter = counter(scheduler.model(slow), trace.slow);
+
+    scheduler.model(fast).connect(scheduler.connect(medium, mediumCounter.out(), fast, -1.0).out(),
+                                  fastCounter.in());
+    scheduler.model(medium).connect(scheduler.connect(fast, fastCounter.out(), medium).out(),
+                                    mediumCounter.in());
+    scheduler.model(slow).connect(scheduler.connect(medium, mediumCounter.out(), slow).out(),
+                                  slowCounter.in());
+    scheduler.compile();
+    EXPECT_EQ(scheduler.executionOrder(), (std::vector<std::size_t>{fast.id, medium.id, slow.id}));
+
+    for (int i = 0; i < ticks; i++)
+    {
+        scheduler.step();
+    }
+    scheduler.synchronize();
+    EXPECT_NEAR(scheduler.time(), ticks * 0.001, 1e-12);
+    return trace;
+}
+}
+
+// Группы выполняются только на своих тактах, переходы частоты детерминированы
+TEST(MultiRateScheduler, RateTransitions)
+{
+    const MultiRateTrace trace = runThreeRates(MultiRateScheduler<double>::Execution::Inline, 1000);
+    ASSERT_EQ(trace.fast.size(), 1000u);
+    ASSERT_EQ(trace.medium.size(), 100u);
+    ASSERT_EQ(trace.slow.size(), 10u);
+
+    // Медленная в быструю: значение предыдущего запуска средней группы, до него - начальное
+    for (std::size_t i = 0; i < trace.fast.size(); i++)
+    {
+        EXPECT_DOUBLE_EQ(trace.fast[i], i < 10 ? -1.0 : static_cast<double>(i / 10));
+    }
+    // Быстрая в медленную: значение быстрой группы на том же такте
+    for (std::size_t k = 0; k < trace.medium.size(); k++)
+    {
+        EXPECT_DOUBLE_EQ(trace.medium[k], static_cast<double>(10 * k + 1));
+    }
+    for (std::size_t k = 0; k < trace.slow.size(); k++)
+    {
+        EXPECT_DOUBLE_EQ(trace.slow[k], static_cast<double>(10 * k + 1));
+    }
+}
+
+// Выполнение медленных групп в отдельных потоках не меняет результат
+TEST(MultiRateScheduler, ThreadedMatchesInline)
+{
+    const MultiRateTrace inlineTrace = runThreeRates(MultiRateScheduler<double>::Execution::Inline, 2000);
+    const MultiRateTrace threadedTrace = runThreeRates(MultiRateScheduler<double>::Execution::Thread, 2000);
+    EXPECT_EQ(inlineTrace.fast, threadedTrace.fast);
+    EXPECT_EQ(inlineTrace.medium, threadedTrace.medium);
+    EXPECT_EQ(inlineTrace.slow, threadedTrace.slow);
+}
+
+// Время групп и исключение из потока группы
+TEST(MultiRateScheduler, GroupTimeAndErrors)
+{
+    using Scheduler = MultiRateScheduler<double>;
+    Scheduler scheduler(0.001, 1.0);
+    auto fast = scheduler.addRate(0.001);
+    auto slow = scheduler.addRate(0.005, Scheduler::Execution::Thread);
+
+    std::vector<double> slowTimes;
+    scheduler.model(slow).addFunction("Clock", 0, 1, false, [&](const BlockIO<double>& io)
+    {
+        slowTimes.push_back(io.time());
+        if (slowTimes.size() == 3)
+        {
+            throw std::runtime_error("Slow task failed");
+        }
+        io.output(0) = io.time();
+    });
+    scheduler.model(fast).addConstant(0.0);
+
+    EXPECT_THROW(scheduler.step(), std::logic_error);
+    EXPECT_THROW(scheduler.connect(fast, {0, 0}, fast), std::invalid_argument);
+    EXPECT_THROW(scheduler.addRate(0.0025), std::invalid_argument);
+    EXPECT_THROW(scheduler.addRate(0.005), std::invalid_argument);
+    EXPECT_THROW(Scheduler(0.0), std::invalid_argument);
+
+    scheduler.compile();
+    for (int i = 0; i < 11; i++)
+    {
+        scheduler.step();
+    }
+    EXPECT_THROW(scheduler.synchronize(), std::runtime_error);
+    ASSERT_EQ(slowTimes.size(), 3u);
+    EXPECT_NEAR(slowTimes[0], 1.0, 1e-12);
+    EXPECT_NEAR(slowTimes[2], 1.01, 1e-12);
+    EXPECT_THROW(scheduler.addRate(0.01), std::logic_error);
+}
+
+// Кратность периодов проверяется с допуском, соответствующим точности типа
+TEST(MultiRateScheduler, FloatPeriods)
+{
+    MultiRateScheduler<float> scheduler(0.001f);
+    auto fast = scheduler.addRate(0.001f);
+    auto medium = scheduler.addRate(0.01f);
+    auto slow = scheduler.addRate(0.1f);
+    EXPECT_THROW(scheduler.addRate(0.0025f), std::invalid_argument);
+    EXPECT_THROW(scheduler.addRate(0.0105f), std::invalid_argument);
+
+    std::vector<float> mediumTimes;
+    scheduler.model(fast).addConstant(0.0f);
+    scheduler.model(medium).addFunction("Clock", 0, 1, false, [&](const BlockIO<float>& io)
+    {
+        mediumTimes.push_back(io.time());
+        io.output(0) = io.time();
+    });
+    scheduler.model(slow).addConstant(0.0f);
+    scheduler.compile();
+    for (int i = 0; i < 25; i++)
+    {
+        scheduler.step();
+    }
+    ASSERT_EQ(mediumTimes.size(), 3u);
+    EXPECT_NEAR(mediumTimes[2], 0.02f, 1e-6f);
+}
@@ -0,0 +1,142 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../include/Simulation/ContinuousModel.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Ошибка решения x' = -x на [0, 1] шагом h
+ */
+double decayError(SolverMethod method, double h)
+{
+    OdeSolver<double> solver(1, SolverOptions{method});
+    auto f = [](double, const double* x, double* dx) { dx[0] = -x[0]; };
+    double t = 0.0;
+    double x = 1.0;
+    const int steps = static_cast<int>(std::lround(1.0 / h));
+    for (int i = 0; i < steps; i++)
+    {
+        solver.advance(f, t, &x, h);
+    }
+    return std::fabs(x - std::exp(-1.0));
+}
+}
+
+// Порядок сходимости методов с фиксированным шагом
+TEST(OdeSolver, ConvergenceOrder)
+{
+    EXPECT_NEAR(decayError(SolverMethod::Euler, 0.01) / decayError(SolverMethod::Euler, 0.005), 2.0, 0.05);
+    EXPECT_NEAR(decayError(SolverMethod::Trapezoidal, 0.01) / decayError(SolverMethod::Trapezoidal, 0.005), 4.0, 0.05);
+    EXPECT_NEAR(decayError(SolverMethod::RungeKutta4, 0.1) / decayError(SolverMethod::RungeKutta4, 0.05), 16.0, 1.0);
+    EXPECT_LT(decayError(SolverMethod::RungeKutta4, 0.01), 1e-10);
+}
+
+// Жёсткая система: явные методы с большим шагом неустойчивы, метод трапеций - нет
+TEST(OdeSolver, StiffTrapezoidal)
+{
+    // x' = -1000 (x - cos t), решение быстро выходит на x ~ cos t
+    auto f = [](double t, const double* x, double* dx) { dx[0] = -1000.0 * (x[0] - std::cos(t)); };
+    auto run = [&](SolverMethod method)
+    {
+        OdeSolver<double> solver(1, SolverOptions{method});
+        double t = 0.0;
+        double x = 0.0;
+        for (int i = 0; i < 100; i++)
+        {
+            solver.advance(f, t, &x, 0.01);
+        }
+        return x;
+    };
+
+    EXPECT_NEAR(run(SolverMethod::Trapezoidal), std::cos(1.0), 1e-3);
+    EXPECT_FALSE(std::fabs(run(SolverMethod::Euler) - std::cos(1.0)) < 1.0);
+    EXPECT_FALSE(std::fabs(run(SolverMethod::RungeKutta4) - std::cos(1.0)) < 1.0);
+}
+
+// Дорман-Принс выдерживает точность и увеличивает шаг на спокойном участке
+TEST(OdeSolver, DormandPrinceAdaptive)
+{
+    SolverOptions options{SolverMethod::DormandPrince};
+    options.relativeTolerance = 1e-8;
+    options.absoluteTolerance = 1e-10;
+    OdeSolver<double> solver(2, options);
+
+    // Гармонический осциллятор x'' = -x на десяти периодах
+    auto oscillator = [](double, const double* x, double* dx)
+    {
+        dx[0] = x[1];
+        dx[1] = -x[0];
+    };
+    double t = 0.0;
+    double x[2] = {1.0, 0.0};
+    solver.advance(oscillator, t, x, 20 * M_PI);
+    EXPECT_DOUBLE_EQ(t, 20 * M_PI);
+    EXPECT_NEAR(x[0], 1.0, 1e-6);
+    EXPECT_NEAR(x[1], 0.0, 1e-6);
+    EXPECT_LT(solver.statistics().steps, 1000u);
+    EXPECT_EQ(solver.statistics().evaluations,
+              1 + 1 + 6 * (solver.statistics().steps + solver.statistics().rejected));
+
+    // Манёвр с быстро меняющимся входом, затем спокойный полёт: шаг растёт на порядки
+    OdeSolver<double> phases(1, options);
+    bool maneuver = true;
+    auto f = [&](double time, const double*, double* dy) { dy[0] = maneuver ? 10.0 * std::cos(10.0 * time) : 0.01; };
+    double time = 0.0;
+    double y = 0.0;
+    phases.advance(f, time, &y, 1.0);
+    EXPECT_NEAR(y, std::sin(10.0), 1e-6);
+    const std::size_t maneuverSteps = phases.statistics().steps;
+    const double maneuverStep = phases.nextStep();
+
+    maneuver = false;
+    phases.advance(f, time, &y, 100.0);
+    EXPECT_NEAR(y, std::sin(10.0) + 1.0, 1e-6);
+    EXPECT_LT(phases.statistics().steps - maneuverSteps, maneuverSteps);
+    EXPECT_GT(phases.nextStep(), 100 * maneuverStep);
+
+    EXPECT_THROW(solver.advance(oscillator, t, x, 0.0), std::invalid_argument);
+    options.minStep = 0.0;
+    EXPECT_THROW(OdeSolver<double>(1, options), std::invalid_argument);
+}
+
+// Модель с интеграторами: масса на пружине с ограничением хода
+TEST(OdeSolver, ContinuousModelWithIntegrators)
+{
+    IntegratorBlock<double, NullMutex> velocity;
+    IntegratorBlock<double, NullMutex> position(-0.5, 0.5);
+    position.setState(0.4);
+
+    SolverOptions options{SolverMethod::DormandPrince};
+    ContinuousModel<double> model(options);
+    const std::size_t v = model.addState(velocity);
+    const std::size_t x = model.addState(position);
+    model.setDerivatives([v, x](double, const double* states, double* derivatives)
+    {
+        derivatives[v] = -4.0 * states[x];
+        derivatives[x] = states[v];
+    });
+    EXPECT_EQ(v, 0u);
+
+    // Без ограничения: x = 0.4 cos 2t
+    model.advance(1.0);
+    EXPECT_NEAR(position.getOutput(), 0.4 * std::cos(2.0), 1e-5);
+    EXPECT_NEAR(velocity.getOutput(), -0.8 * std::sin(2.0), 1e-5);
+    EXPECT_DOUBLE_EQ(model.time(), 1.0);
+
+    // Начальное отклонение за пределом хода ограничивается после первого шага
+    position.setState(2.0);
+    velocity.setState(0.0);
+    model.advance(0.01);
+    EXPECT_DOUBLE_EQ(position.getOutput(), 0.5);
+    EXPECT_DOUBLE_EQ(model.state(x), 0.5);
+
+    ContinuousModel<double> empty;
+    EXPECT_THROW(empty.advance(1.0), std::logic_error);
+}
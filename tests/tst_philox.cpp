@@ -0,0 +1,96 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../include/Philox.hpp"
+#include "../include/RandomNumberGenerator.hpp"
+#include "../include/WhiteNoiseGenerator.hpp"
+
+using namespace SimulinkBlock;
+
+
+// Эталонные значения Philox4x32-10 из набора известных ответов Random123
+TEST(Philox4x32, KnownAnswers)
+{
+    EXPECT_EQ(Philox4x32::generateBlock({0, 0, 0, 0}, {0, 0}),
+              (Philox4x32::Block{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+
+    EXPECT_EQ(Philox4x32::generateBlock({0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                                        {0xffffffffu, 0xffffffffu}),
+              (Philox4x32::Block{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+
+    EXPECT_EQ(Philox4x32::generateBlock({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                                        {0xa4093822u, 0x299f31d0u}),
+              (Philox4x32::Block{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+// Пропуск чисел эквивалентен их последовательной генерации
+TEST(Philox4x32, DiscardMatchesSequence)
+{
+    Philox4x32 sequential(42, 7);
+    std::vector<std::uint32_t> values(1000);
+    for (auto& value : values)
+    {
+        value = sequential();
+    }
+
+    for (std::uint64_t skip : {0u, 1u, 3u, 4u, 5u, 517u, 999u})
+    {
+        Philox4x32 skipping(42, 7);
+        skipping.discard(skip);
+        EXPECT_EQ(skipping.tell(), skip);
+        EXPECT_EQ(skipping(), values[skip]) << "skip " << skip;
+    }
+
+    Philox4x32 far(42, 7);
+    far.discard(1000000000000ull);
+    EXPECT_EQ(far(), far.block(250000000000ull)[0]);
+}
+
+// Разные зёрна и потоки дают разные последовательности, одинаковые - одинаковые
+TEST(Philox4x32, SeedsAndStreams)
+{
+    Philox4x32 a(1, 0), b(1, 0), c(1, 1), d(2, 0);
+    EXPECT_TRUE(a == b);
+    EXPECT_TRUE(a != c);
+
+    int sameStream = 0, otherStream = 0, otherSeed = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        std::uint32_t value = a();
+        sameStream += value == b();
+        otherStream += value == c();
+        otherSeed += value == d();
+    }
+    EXPECT_EQ(sameStream, 100);
+    EXPECT_LT(otherStream, 2);
+    EXPECT_LT(otherSeed, 2);
+
+    a.seed(1, 0);
+    b.seed(1, 0);
+    EXPECT_EQ(a, b);
+    EXPECT_LE(sizeof(Philox4x32), 48u);
+}
+
+// Блоки с генератором Philox воспроизводят последовательности
+TEST(Philox4x32, ReproducibleBlocks)
+{
+    RandomNumberGenerator<double, std::mutex, Philox4x32> first(Philox4x32(123, 4));
+    RandomNumberGenerator<double, std::mutex, Philox4x32> second(Philox4x32(123, 4));
+    WhiteNoiseGenerator<double, std::mutex, Philox4x32> noise1(0.0, 1.0, Philox4x32(5));
+    WhiteNoiseGenerator<double, std::mutex, Philox4x32> noise2(0.0, 1.0, Philox4x32(5));
+
+    for (int i = 0; i < 100; i++)
+    {
+        first.step();
+        second.step();
+        EXPECT_EQ(first.getOutput(), second.getOutput());
+        EXPECT_GE(first.getOutput(), 0.0);
+        EXPECT_LT(first.getOutput(), 1.0);
+
+        noise1.step();
+        noise2.step();
+        EXPECT_EQ(noise1.getOutput(), noise2.getOutput());
+    }
+}
@@ -64,3 +64,11 @@ TEST_F(PIDTest, NegativeSaturatedStep)
     EXPECT_DOUBLE_EQ(pid_saturated.getOutput(), -101);
     pid_r.reset();
 }
+
+// ПИД регулятор без синхронизации должен давать тот же выход
+TEST_F(PIDTest, NullMutexPolicyStep)
+{
+    PID<double, NullMutex> unsynchronized{1, 1, 1};
+    unsynchronized.step(1, 0.1);
+    EXPECT_DOUBLE_EQ(unsynchronized.getOutput(), 11.1);
+}
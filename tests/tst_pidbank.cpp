@@ -0,0 +1,95 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "../include/PIDBank.hpp"
+#include "../include/PID.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+// Каждый канал банка должен побитово совпадать с отдельным PID (при сборке с FMA - с точностью до округления)
+template <typename T>
+void expectMatchesPid(T derivativeLimit)
+{
+    const std::size_t lanes = 21;
+    PIDBank<T, NullMutex> bank(lanes);
+    std::vector<PID<T, NullMutex>> pids(lanes);
+
+    for (std::size_t i = 0; i < lanes; i++)
+    {
+        T p = static_cast<T>(0.5 + 0.1 * i);
+        T k = static_cast<T>(0.01 * i);
+        T d = static_cast<T>(0.2 - 0.03 * i);
+        bank.setCoeffs(i, p, k, d);
+        pids[i].setCoeffs(p, k, d);
+        bank.setLimits(i, -1, 1, -derivativeLimit, derivativeLimit);
+        pids[i].setLimits(-1, 1, -derivativeLimit, derivativeLimit);
+    }
+
+    std::vector<T> inputs(lanes);
+    for (int k = 0; k < 300; k++)
+    {
+        for (std::size_t i = 0; i < lanes; i++)
+        {
+            inputs[i] = static_cast<T>(std::sin(0.05 * k * (1.0 + i)) * 3.0);
+            pids[i].step(inputs[i], 0.01);
+        }
+        bank.step(inputs, 0.01);
+
+        for (std::size_t i = 0; i < lanes; i++)
+        {
+#if defined(__FMA__)
+            // С FMA скалярный PID может слить умножение и сложение, ядра банка - нет
+            ASSERT_NEAR(bank.getOutput(i), pids[i].getOutput(),
+                        8 * std::numeric_limits<T>::epsilon() * (std::fabs(pids[i].getOutput()) + 1));
+#else
+            ASSERT_EQ(bank.getOutput(i), pids[i].getOutput());
+#endif
+        }
+    }
+}
+
+TEST(PIDBank, MatchesPidDouble)
+{
+    expectMatchesPid<double>(2.0);
+    expectMatchesPid<double>(1e6);
+}
+
+// Пределы не ограничивают производную, поэтому проверяется и деление на dt
+TEST(PIDBank, MatchesPidFloat)
+{
+    expectMatchesPid<float>(1e6f);
+}
+
+// Шаг с одинаковыми коэффициентами совпадает с тестами PID
+TEST(PIDBank, PositiveAndNegativeStep)
+{
+    PIDBank<double> bank(5, 1, 1, 1);
+    bank.step({1, -1, 1, -1, 0}, 0.1);
+    EXPECT_DOUBLE_EQ(bank.getOutput(0), 11.1);
+    EXPECT_DOUBLE_EQ(bank.getOutput(1), -11.1);
+    EXPECT_DOUBLE_EQ(bank.getOutput(4), 0.0);
+}
+
+// Изменение коэффициентов и обнуление одного канала не затрагивает остальные
+TEST(PIDBank, PerLaneUpdateAndReset)
+{
+    PIDBank<double> bank(6, 1, 1, 1);
+    bank.setCoeffs(2, 2, 0, 0);
+    bank.step(std::vector<double>(6, 1.0), 0.1);
+    EXPECT_DOUBLE_EQ(bank.getOutput(2), 2.0);
+    EXPECT_DOUBLE_EQ(bank.getOutput(3), 11.1);
+
+    bank.reset(3);
+    EXPECT_EQ(bank.getOutput(3), 0.0);
+    EXPECT_DOUBLE_EQ(bank.getOutput(4), 11.1);
+
+    bank.step(std::vector<double>(6, 1.0), 0.1);
+    EXPECT_EQ(bank.getOutput(3), 0.0);
+    EXPECT_DOUBLE_EQ(bank.getOutput(4), 1.0 + 0.2);
+    EXPECT_THROW(bank.setLimits(0, 1, -1, 0, 0), std::invalid_argument);
+}
@@ -0,0 +1,158 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "../include/Simulation/PidTuner.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+/**
+ * @brief Объект второго порядка: двигатель с инерцией, y'' = (u - y') / 0.5
+ */
+auto makeMotor()
+{
+    return []
+    {
+        return [position = 0.0, velocity = 0.0](double control, double dt) mutable
+        {
+            velocity += (control - velocity) / 0.5 * dt;
+            position += velocity * dt;
+            return position;
+        };
+    };
+}
+
+std::vector<double> linspace(double first, double last, std::size_t count)
+{
+    std::vector<double> values(count);
+    for (std::size_t k = 0; k < count; k++)
+    {
+        values[k] = first + (last - first) * static_cast<double>(k) / static_cast<double>(count - 1);
+    }
+    return values;
+}
+}
+
+// Таблица перебора совпадает с перебором без досрочного прекращения
+TEST(PidTuner, GridSearchWithEarlyTermination)
+{
+    TuningOptions options;
+    options.duration = 5.0;
+    options.itaeWeight = 0.5;
+    options.overshootWeight = 2.0;
+    options.tableSize = 5;
+
+    PidTuner tuner(makeMotor(), options, 4);
+    options.earlyTermination = false;
+    PidTuner exhaustive(makeMotor(), options, 1);
+
+    const auto p = linspace(0.0, 20.0, 11);
+    const auto i = linspace(0.0, 2.0, 5);
+    const auto d = linspace(0.0, 2.0, 5);
+    const std::vector<TuningResult> table = tuner.gridSearch(p, i, d);
+    const std::vector<TuningResult> reference = exhaustive.gridSearch(p, i, d);
+
+    ASSERT_EQ(table.size(), 5u);
+    ASSERT_EQ(reference.size(), 5u);
+    for (std::size_t k = 0; k < table.size(); k++)
+    {
+        EXPECT_EQ(table[k].status, TuningStatus::Completed);
+        EXPECT_DOUBLE_EQ(table[k].cost, reference[k].cost);
+        EXPECT_DOUBLE_EQ(table[k].gains.p, reference[k].gains.p);
+        EXPECT_DOUBLE_EQ(table[k].gains.i, reference[k].gains.i);
+        EXPECT_DOUBLE_EQ(table[k].gains.d, reference[k].gains.d);
+        if (k > 0)
+        {
+            EXPECT_LE(table[k - 1].cost, table[k].cost);
+        }
+    }
+
+    EXPECT_EQ(tuner.evaluationCount(), p.size() * i.size() * d.size());
+    EXPECT_GT(tuner.stoppedCount(), 0u);
+    EXPECT_LT(tuner.simulatedSteps(), exhaustive.simulatedSteps());
+}
+
+// Нелдер-Мид улучшает начальные точки и приходит к лучшему результату сетки
+TEST(PidTuner, NelderMead)
+{
+    TuningOptions options;
+    options.duration = 5.0;
+    options.itaeWeight = 0.5;
+    options.overshootWeight = 2.0;
+    PidTuner tuner(makeMotor(), options, 2);
+
+    const std::vector<PidGains> starts = {{1.0, 0.0, 0.0}, {10.0, 1.0, 1.0}, {4.0, 0.5, 0.2}};
+    const std::vector<TuningResult> table = tuner.nelderMead(starts, {1.0, 0.1, 0.1}, 300);
+    ASSERT_EQ(table.size(), starts.size());
+    for (std::size_t k = 1; k < table.size(); k++)
+    {
+        EXPECT_LE(table[k - 1].cost, table[k].cost);
+    }
+    for (const PidGains& start : starts)
+    {
+        EXPECT_LT(table.back().cost, tuner.evaluate(start).cost);
+    }
+
+    const auto grid = tuner.gridSearch(linspace(0.0, 20.0, 11), linspace(0.0, 2.0, 5), linspace(0.0, 2.0, 5));
+    EXPECT_LE(table.front().cost, grid.front().cost);
+}
+
+// Расходящиеся процессы прекращаются и не попадают в таблицу
+TEST(PidTuner, Divergence)
+{
+    TuningOptions options;
+    options.duration = 20.0;
+    PidTuner tuner([]
+    {
+        // Неустойчивый объект y' = y + u
+        return [y = 0.0](double control, double dt) mutable
+        {
+            y += (y + control) * dt;
+            return y;
+        };
+    }, options, 1);
+
+    const TuningResult unstable = tuner.evaluate({0.5, 0.0, 0.0});
+    EXPECT_EQ(unstable.status, TuningStatus::Diverged);
+    EXPECT_TRUE(std::isinf(unstable.cost));
+    EXPECT_LT(tuner.simulatedSteps(), 2000u);
+    EXPECT_EQ(tuner.evaluate({5.0, 0.0, 0.0}).status, TuningStatus::Completed);
+
+    const auto table = tuner.gridSearch({0.5, 0.7, 5.0}, {0.0}, {0.0});
+    ASSERT_EQ(table.size(), 1u);
+    EXPECT_DOUBLE_EQ(table[0].gains.p, 5.0);
+
+    options.reference = 0.0;
+    EXPECT_THROW(PidTuner(makeMotor(), options), std::invalid_argument);
+}
+
+// Таблица сохраняется в CSV и загружается в регулятор
+TEST(PidTuner, GainTableFile)
+{
+    std::vector<TuningResult> table(2);
+    table[0].gains = {2.5, 0.125, 0.75};
+    table[1].gains = {1.0 / 3.0, 0.0, 1e-7};
+    const std::string path = testing::TempDir() + "gains.csv";
+    saveGainTable(path, table);
+
+    const std::vector<PidGains> loaded = loadGainTable(path);
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_DOUBLE_EQ(loaded[1].p, 1.0 / 3.0);
+    EXPECT_DOUBLE_EQ(loaded[1].d, 1e-7);
+
+    PID<double, NullMutex> tuned;
+    PID<double, NullMutex> reference(2.5, 0.125, 0.75);
+    loaded[0].applyTo(tuned);
+    tuned.step(1.0, 0.1);
+    reference.step(1.0, 0.1);
+    EXPECT_DOUBLE_EQ(tuned.getOutput(), reference.getOutput());
+
+    std::remove(path.c_str());
+    EXPECT_THROW(loadGainTable(path), std::runtime_error);
+}
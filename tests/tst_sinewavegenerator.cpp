@@ -1,6 +1,11 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 #include "../include/SineWaveGenerator.hpp"
 
 
@@ -37,3 +42,111 @@ TEST(SineWaveGeneratorTest, ResetFunction)
     generator.step(0.0);
     EXPECT_NEAR(generator.getOutput(), 0.0, 0.0001);
 }
+
+// Режим с постоянным шагом совпадает с вычислением по времени на коротком интервале
+TEST(SineWaveGeneratorTest, FixedStepMatchesTimeBased)
+{
+    SimulinkBlock::SineWaveGenerator<double, double> incremental(2.0, 3.0, 0.5);
+    SimulinkBlock::SineWaveGenerator<double, double> timeBased(2.0, 3.0, 0.5);
+    incremental.setFixedStep(0.001, 0.25);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        incremental.step();
+        timeBased.step(0.25 + i * 0.001);
+        EXPECT_NEAR(incremental.getOutput(), timeBased.getOutput(), 1e-11) << "step " << i;
+    }
+}
+
+// Ошибка фазы не накапливается на длинном интервале
+TEST(SineWaveGeneratorTest, FixedStepLongRunDrift)
+{
+    const double frequency = 50.0;
+    const double dt = 1e-4;
+    SimulinkBlock::SineWaveGenerator<double, double, SimulinkBlock::NullMutex> generator(1.0, frequency, 0.0);
+    generator.setFixedStep(dt);
+
+    // Эталон: точная фаза в периодах для шага frequency * dt, вычисленная в long double
+    const long double cyclesPerStep = frequency * dt;
+    double maxError = 0.0;
+    for (std::uint64_t n = 0; n < 10000000; n++)
+    {
+        generator.step();
+        if (n % 1009 == 0)
+        {
+            long double cycles = cyclesPerStep * static_cast<long double>(n);
+            cycles -= std::floor(cycles);
+            double expected = static_cast<double>(std::sin(2.0L * static_cast<long double>(M_PI) * cycles));
+            maxError = std::max(maxError, std::abs(generator.getOutput() - expected));
+        }
+    }
+    EXPECT_LT(maxError, 1e-11);
+}
+
+// Шаг без аргументов требует настройки постоянного шага
+TEST(SineWaveGeneratorTest, FixedStepNotSet)
+{
+    SimulinkBlock::SineWaveGenerator<double, double> generator;
+    EXPECT_THROW(generator.step(), std::logic_error);
+
+    generator.setFixedStep(0.01);
+    generator.reset();
+    EXPECT_THROW(generator.step(), std::logic_error);
+}
+
+// Смена параметров продолжает генерацию с текущего момента времени
+TEST(SineWaveGeneratorTest, FixedStepSetup)
+{
+    SimulinkBlock::SineWaveGenerator<double, double> generator;
+    generator.setFixedStep(0.01);
+    for (int i = 0; i < 100; i++)
+    {
+        generator.step();
+    }
+
+    generator.setup(3.0, 2.0, 0.1);
+    generator.step();
+    EXPECT_NEAR(generator.getOutput(), 3.0 * std::sin(2 * M_PI * 2.0 * 1.0 + 0.1), 1e-12);
+}
+
+// Заполнение буфера совпадает с поэлементным вычислением по времени
+TEST(SineWaveGeneratorTest, GenerateMatchesStep)
+{
+    SimulinkBlock::SineWaveGenerator<double, double> generator(1.5, 7.0, 0.3);
+    std::vector<double> buffer(200000);
+    generator.generate(0.125, 1e-4, buffer.data(), buffer.size());
+
+    for (std::size_t i = 0; i < buffer.size(); i += 7)
+    {
+        generator.step(0.125 + static_cast<double>(i) * 1e-4);
+        EXPECT_NEAR(buffer[i], generator.getOutput(), 1e-11) << "sample " << i;
+    }
+}
+
+// Ошибка многочлена не превышает заявленной
+TEST(SineWaveGeneratorTest, GenerateKernelError)
+{
+    const long double pi = 3.141592653589793238462643383279502884L;
+    double maxError = 0.0;
+    for (int i = -400000; i <= 400000; i++)
+    {
+        double cycles = static_cast<double>(i) / 100000.0 + 0.3;
+        long double reduced = static_cast<long double>(cycles) - std::floor(static_cast<long double>(cycles));
+        double exact = static_cast<double>(std::sin(2.0L * pi * reduced));
+        maxError = std::max(maxError, std::abs(SimulinkBlock::detail::sinCycles(cycles) - exact));
+    }
+    EXPECT_LT(maxError, 4.5e-16);
+}
+
+// Буфер нулевой длины и float на выходе
+TEST(SineWaveGeneratorTest, GenerateFloatOutput)
+{
+    SimulinkBlock::SineWaveGenerator<float, double> generator(2.0, 1.0, 0.0);
+    generator.generate(0.0, 0.1, nullptr, 0);
+
+    std::vector<float> buffer(11);
+    generator.generate(0.0, 0.025, buffer.data(), buffer.size());
+    EXPECT_FLOAT_EQ(buffer[10], 2.0f);
+    EXPECT_NEAR(buffer[0], 0.0f, 1e-7f);
+    EXPECT_EQ(generator.getOutput(), 0.0f);
+}
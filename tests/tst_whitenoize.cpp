@@ -1,9 +1,59 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "../include/WhiteNoiseGenerator.hpp"
 
 
+namespace
+{
+/**
+ * @brief Статистика Колмогорова-Смирнова для нормального распределения
+ */
+double kolmogorovSmirnov(std::vector<double> samples, double mean, double stddev)
+{
+    std::sort(samples.begin(), samples.end());
+    const double n = static_cast<double>(samples.size());
+    double distance = 0.0;
+    for (std::size_t i = 0; i < samples.size(); i++)
+    {
+        double cdf = 0.5 * std::erfc(-(samples[i] - mean) / (stddev * std::sqrt(2.0)));
+        distance = std::max({distance, cdf - i / n, (i + 1) / n - cdf});
+    }
+    return distance * std::sqrt(n);
+}
+
+/**
+ * @brief Проверить среднее, дисперсию и согласие с нормальным распределением
+ */
+void expectNormal(const std::vector<double>& samples, double mean, double stddev)
+{
+    const double n = static_cast<double>(samples.size());
+    double sum = 0.0;
+    for (double value : samples)
+    {
+        sum += value;
+    }
+    const double sampleMean = sum / n;
+
+    double squares = 0.0;
+    for (double value : samples)
+    {
+        squares += (value - sampleMean) * (value - sampleMean);
+    }
+    const double sampleVariance = squares / (n - 1);
+
+    // Допуски - пять стандартных ошибок оценок
+    EXPECT_NEAR(sampleMean, mean, 5 * stddev / std::sqrt(n));
+    EXPECT_NEAR(sampleVariance, stddev * stddev, 5 * stddev * stddev * std::sqrt(2.0 / (n - 1)));
+    // Критическое значение статистики sqrt(n) * D для уровня значимости 0.001
+    EXPECT_LT(kolmogorovSmirnov(samples, mean, stddev), 1.95);
+}
+}
+
 // Проверка выходных данных после инициализации
 TEST(WhiteNoiseGenerator, DefaultConstructor)
 {
@@ -19,3 +69,60 @@ TEST(WhiteNoiseGenerator, ResetFunction)
     generator.reset();
     EXPECT_EQ(generator.getOutput(), 0);
 }
+
+// Статистические свойства пакетной генерации
+TEST(WhiteNoiseGenerator, FillStatistics)
+{
+    SimulinkBlock::WhiteNoiseGenerator<double, std::mutex, SimulinkBlock::Philox4x32>
+        generator(5.0, 2.0, SimulinkBlock::Philox4x32(2024));
+
+    std::vector<double> samples(200001);
+    generator.fill(samples.data(), samples.size());
+    expectNormal(samples, 5.0, 2.0);
+    EXPECT_EQ(generator.getOutput(), 0.0);
+}
+
+// Статистические свойства поэлементной генерации через буфер
+TEST(WhiteNoiseGenerator, StepStatistics)
+{
+    SimulinkBlock::WhiteNoiseGenerator<double, std::mutex, SimulinkBlock::Philox4x32>
+        generator(-1.0, 0.5, SimulinkBlock::Philox4x32(11));
+
+    std::vector<double> samples(100000);
+    for (double& value : samples)
+    {
+        generator.step();
+        value = generator.getOutput();
+    }
+    expectNormal(samples, -1.0, 0.5);
+}
+
+// Поэлементная и пакетная генерация с одним генератором дают одну последовательность
+TEST(WhiteNoiseGenerator, StepMatchesFill)
+{
+    using Generator = SimulinkBlock::WhiteNoiseGenerator<float, SimulinkBlock::NullMutex, SimulinkBlock::Philox4x32>;
+    Generator stepping(0.0f, 1.0f, SimulinkBlock::Philox4x32(7, 3));
+    Generator filling(0.0f, 1.0f, SimulinkBlock::Philox4x32(7, 3));
+
+    std::vector<float> expected(3 * Generator::prefetchSize);
+    filling.fill(expected.data(), expected.size());
+
+    for (float value : expected)
+    {
+        stepping.step();
+        EXPECT_EQ(stepping.getOutput(), value);
+    }
+}
+
+// Нечётная длина массива заполняется полностью
+TEST(WhiteNoiseGenerator, FillOddCount)
+{
+    SimulinkBlock::WhiteNoiseGenerator<double> generator(0.0, 1.0);
+    std::vector<double> samples(257, 1e300);
+    generator.fill(samples.data(), samples.size());
+    for (double value : samples)
+    {
+        EXPECT_LT(std::abs(value), 10.0);
+    }
+    generator.fill(nullptr, 0);
+}
@@ -0,0 +1,211 @@
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../include/ConditionalSubsystem.hpp"
+#include "../include/IntegratorBlock.hpp"
+#include "../include/Simulation/ContinuousModel.hpp"
+#include "../include/Simulation/EventQueue.hpp"
+#include "../include/Simulation/ZeroCrossing.hpp"
+
+using namespace testing;
+using namespace SimulinkBlock;
+
+
+namespace
+{
+constexpr double gravity = 9.81;
+
+/**
+ * @brief Моменты первых отскоков мяча, брошенного с высоты 10 м, при шаге модели dt
+ */
+std::vector<double> bounceTimes(SolverMethod method, double dt)
+{
+    IntegratorBlock<double, NullMutex> height;
+    IntegratorBlock<double, NullMutex> velocity;
+    height.setState(10.0);
+
+    ContinuousModel<double> model(SolverOptions{method});
+    const std::size_t h = model.addState(height);
+    const std::size_t v = model.addState(velocity);
+    model.setDerivatives([h, v](double, const double* x, double* dx)
+    {
+        dx[h] = x[v];
+        dx[v] = -gravity;
+    });
+
+    std::vector<double> times;
+    model.addZeroCrossing([h](double, const double* x) { return x[h]; }, CrossingDirection::Falling,
+                          [&times, v](double time, double* x)
+                          {
+                              times.push_back(time);
+                              x[v] = -0.5 * x[v];
+                          });
+    while (model.time() < 4.0)
+    {
+        model.advance(dt);
+    }
+    EXPECT_EQ(model.zeroCrossings(), times.size());
+    return times;
+}
+}
+
+// События выполняются по времени, одновременные - в порядке добавления
+TEST(EventQueue, Order)
+{
+    EventQueue<double> queue;
+    std::vector<int> fired;
+    queue.schedule(2.0, [&](double) { fired.push_back(2); });
+    queue.schedule(1.0, [&](double) { fired.push_back(1); });
+    queue.schedule(2.0, [&](double) { fired.push_back(3); });
+    queue.schedule(0.5, [&](double time)
+    {
+        fired.push_back(0);
+        queue.schedule(time + 0.25, [&](double) { fired.push_back(4); });
+    });
+    EXPECT_EQ(queue.size(), 4u);
+    EXPECT_DOUBLE_EQ(queue.nextTime(), 0.5);
+
+    EXPECT_EQ(queue.runUntil(1.0), 3u);
+    EXPECT_THAT(fired, ElementsAre(0, 4, 1));
+    EXPECT_EQ(queue.runUntil(5.0), 2u);
+    EXPECT_THAT(fired, ElementsAre(0, 4, 1, 2, 3));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(std::isinf(queue.nextTime()));
+    EXPECT_THROW(queue.pop(), std::logic_error);
+}
+
+// Уточнение момента пересечения и направления
+TEST(ZeroCrossing, Locate)
+{
+    EXPECT_TRUE(detail::crossesZero(-1.0, 0.0, CrossingDirection::Rising));
+    EXPECT_FALSE(detail::crossesZero(0.0, 1.0, CrossingDirection::Rising));
+    EXPECT_FALSE(detail::crossesZero(-1.0, 1.0, CrossingDirection::Falling));
+    EXPECT_TRUE(detail::crossesZero(1.0, -1.0, CrossingDirection::Either));
+
+    int evaluations = 0;
+    auto g = [&](double t)
+    {
+        ++evaluations;
+        return std::cos(t);
+    };
+    const double root = detail::locateZeroCrossing(g, 0.0, 1.0, 3.0, std::cos(3.0), 1e-12);
+    EXPECT_NEAR(root, M_PI / 2, 1e-12);
+    EXPECT_LE(std::cos(root), 0.0);
+    EXPECT_LT(evaluations, 15);
+}
+
+// Отскоки мяча находятся точно при шаге модели, много большем точности
+TEST(ZeroCrossing, BouncingBall)
+{
+    // Первый отскок в sqrt(2 h / g), следующие через 2 v / g при скорости, уменьшенной вдвое
+    const double first = std::sqrt(2 * 10.0 / gravity);
+    const double second = first + 2 * (0.5 * gravity * first) / gravity;
+
+    for (SolverMethod method : {SolverMethod::RungeKutta4, SolverMethod::DormandPrince})
+    {
+        const std::vector<double> times = bounceTimes(method, 0.1);
+        ASSERT_GE(times.size(), 2u);
+        EXPECT_NEAR(times[0], first, 1e-9);
+        EXPECT_NEAR(times[1], second, 1e-9);
+    }
+
+    // Без уточнения момент события определялся бы с точностью до шага
+    const std::vector<double> coarse = bounceTimes(SolverMethod::RungeKutta4, 0.5);
+    ASSERT_GE(coarse.size(), 2u);
+    EXPECT_NEAR(coarse[0], first, 1e-9);
+}
+
+// Один advance() охватывает несколько отскоков: каждый находится и обрабатывается
+TEST(ZeroCrossing, SeveralBouncesInOneAdvance)
+{
+    // Отскоки через 2 * 0.8^k * sqrt(2 h / g) после первого
+    const double first = std::sqrt(2 * 10.0 / gravity);
+    const std::vector<double> expected = {first, first + 1.6 * first, first + 1.6 * first + 1.28 * first};
+
+    for (SolverMethod method : {SolverMethod::RungeKutta4, SolverMethod::DormandPrince})
+    {
+        for (double duration : {4.0, 6.0})
+        {
+            IntegratorBlock<double, NullMutex> height;
+            IntegratorBlock<double, NullMutex> velocity;
+            height.setState(10.0);
+
+            ContinuousModel<double> model(SolverOptions{method});
+            model.addState(height);
+            model.addState(velocity);
+            model.setDerivatives([](double, const double* x, double* dx)
+            {
+                dx[0] = x[1];
+                dx[1] = -gravity;
+            });
+            std::vector<double> times;
+            model.addZeroCrossing([](double, const double* x) { return x[0]; }, CrossingDirection::Falling,
+                                  [&times](double time, double* x)
+                                  {
+                                      times.push_back(time);
+                                      x[1] = -0.8 * x[1];
+                                  });
+            model.advance(duration);
+
+            const std::size_t count = duration < 5.0 ? 2 : 3;
+            ASSERT_EQ(times.size(), count);
+            for (std::size_t k = 0; k < count; k++)
+            {
+                EXPECT_NEAR(times[k], expected[k], 1e-8);
+            }
+            EXPECT_GT(height.getOutput(), 0.0);
+            EXPECT_DOUBLE_EQ(model.time(), duration);
+        }
+    }
+
+    // Действие, не меняющее состояния, не приводит к повторному срабатыванию
+    IntegratorBlock<double, NullMutex> position;
+    position.setState(1.0);
+    ContinuousModel<double> model;
+    model.addState(position);
+    model.setDerivatives([](double, const double*, double* dx) { dx[0] = -1.0; });
+    model.addZeroCrossing([](double, const double* x) { return x[0]; }, CrossingDirection::Either,
+                          [](double, double*) {});
+    model.advance(3.0);
+    EXPECT_EQ(model.zeroCrossings(), 1u);
+    EXPECT_NEAR(position.getOutput(), -2.0, 1e-12);
+}
+
+// События по времени останавливают интегрирование и запускают триггерную подсистему
+TEST(ZeroCrossing, ScheduledEvents)
+{
+    IntegratorBlock<double, NullMutex> position;
+    ContinuousModel<double> model;
+    model.addState(position);
+    model.setDerivatives([](double, const double*, double* dx) { dx[0] = 1.0; });
+
+    ConditionalSubsystem<double, double, NullMutex> sample(Activation::Rising, [](const double& input, const double&)
+    {
+        return input;
+    });
+    std::vector<double> times;
+    model.schedule(0.25, [&](double time, double* x)
+    {
+        times.push_back(time);
+        sample.step(x[0], 1.0, time);
+    });
+    model.schedule(0.75, [&](double time, double* x)
+    {
+        times.push_back(time);
+        x[0] = 0.0;
+    });
+    EXPECT_EQ(model.pendingEvents(), 2u);
+
+    model.advance(1.0);
+    EXPECT_THAT(times, ElementsAre(0.25, 0.75));
+    EXPECT_DOUBLE_EQ(sample.getOutput(), 0.25);
+    EXPECT_DOUBLE_EQ(position.getOutput(), 0.25);
+    EXPECT_DOUBLE_EQ(model.time(), 1.0);
+    EXPECT_EQ(model.pendingEvents(), 0u);
+
+    EXPECT_THROW(model.schedule(2.0, nullptr), std::invalid_argument);
+    EXPECT_THROW(model.setEventTolerance(0.0), std::invalid_argument);
+}
@@ -0,0 +1,87 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../include/MappedLookupTable1D.hpp"
+
+
+using namespace SimulinkBlock;
+
+/**
+ * @brief Прочитать два столбца (вход, выход) из CSV-файла
+ *
+ * Разделителем служит запятая, точка с запятой или пробельный символ.
+ * Строки, которые не удалось разобрать (например, заголовок), пропускаются.
+ */
+template <typename T>
+bool readCsv(const std::string& path, std::vector<T>& inputs, std::vector<T>& outputs)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        for (char& c : line)
+        {
+            if (c == ',' || c == ';')
+            {
+                c = ' ';
+            }
+        }
+
+        std::istringstream stream(line);
+        T input, output;
+        if (stream >> input >> output)
+        {
+            inputs.push_back(input);
+            outputs.push_back(output);
+        }
+    }
+    return true;
+}
+
+template <typename T>
+int convert(const std::string& source, const std::string& destination)
+{
+    std::vector<T> inputs;
+    std::vector<T> outputs;
+    if (!readCsv(source, inputs, outputs))
+    {
+        std::cerr << "Cannot open " << source << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        writeLookupTableFile(destination, inputs, outputs);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Written " << inputs.size() << " points to " << destination << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3 || argc > 4 || (argc == 4 && std::string(argv[3]) != "--float"))
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.csv> <output.lut> [--float]" << std::endl;
+        return 1;
+    }
+
+    if (argc == 4)
+    {
+        return convert<float>(argv[1], argv[2]);
+    }
+    return convert<double>(argv[1], argv[2]);
+}